@@ -133,7 +133,8 @@ public:
     if ((mi.type() == MetaInfo::RESTART) &&
         (mi.restart() > 0) && (p > 0.0)) {
       const Photo& l = static_cast<const Photo&>(*mi.last());
-      relax(*this, pos, l.pos, rnd, p);
+      // Use the probability as adapted by the engine
+      relax(*this, pos, l.pos, rnd, (mi.relax() > 0.0) ? mi.relax() : p);
       return false;
     } else {
       return true;
@@ -0,0 +1,144 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/driver.hh>
+#include <gecode/int.hh>
+#include <gecode/minimodel.hh>
+
+using namespace Gecode;
+
+/**
+ * \brief %Options for %TupleSetBench
+ *
+ * \relates TupleSetBench
+ */
+class TupleSetBenchOptions : public Options {
+private:
+  Driver::UnsignedIntOption _n; ///< Number of variables
+  Driver::UnsignedIntOption _d; ///< Domain size
+  Driver::UnsignedIntOption _c; ///< Number of constraints
+  Driver::UnsignedIntOption _a; ///< Arity of constraints
+  Driver::UnsignedIntOption _t; ///< Number of tuples per constraint
+public:
+  /// Initialize options for example with name \a s
+  TupleSetBenchOptions(const char* s)
+    : Options(s),
+      _n("n", "number of variables", 30),
+      _d("d", "domain size", 8),
+      _c("c", "number of table constraints", 20),
+      _a("a", "arity of table constraints", 5),
+      _t("t", "number of tuples per table constraint", 4096) {
+    add(_n); add(_d); add(_c); add(_a); add(_t);
+  }
+  /// Return number of variables
+  int n(void) const { return static_cast<int>(_n.value()); }
+  /// Return domain size
+  int d(void) const { return static_cast<int>(_d.value()); }
+  /// Return number of constraints
+  int c(void) const { return static_cast<int>(_c.value()); }
+  /// Return arity of constraints
+  int a(void) const { return static_cast<int>(_a.value()); }
+  /// Return number of tuples per constraint
+  int t(void) const { return static_cast<int>(_t.value()); }
+};
+
+/**
+ * \brief %Example: Random table constraints
+ *
+ * Posts random table constraints with many tuples on random variables.
+ * The example serves as a benchmark for the propagation of table
+ * constraints defined by tuple sets: with thousands of tuples per
+ * constraint, propagation time is dominated by operations on the
+ * bit-sets of the propagators. Use \c -mode \c time for measurements.
+ *
+ * \ingroup Example
+ *
+ */
+class TupleSetBench : public Script {
+protected:
+  /// The variables
+  IntVarArray x;
+public:
+  /// Actual model
+  TupleSetBench(const TupleSetBenchOptions& opt)
+    : Script(opt), x(*this,opt.n(),0,opt.d()-1) {
+    Rnd r(opt.seed());
+    for (int i=0; i<opt.c(); i++) {
+      // Random scope of distinct variables
+      IntArgs p = IntArgs::create(opt.n(),0);
+      for (int j=0; j<opt.a(); j++)
+        std::swap(p[j],p[j+static_cast<int>(r(opt.n()-j))]);
+      IntVarArgs s(opt.a());
+      for (int j=0; j<opt.a(); j++)
+        s[j] = x[p[j]];
+      // Random tuples
+      TupleSet ts(opt.a());
+      IntArgs t(opt.a());
+      for (int k=0; k<opt.t(); k++) {
+        for (int j=0; j<opt.a(); j++)
+          t[j] = static_cast<int>(r(opt.d()));
+        ts.add(t);
+      }
+      ts.finalize();
+      extensional(*this, s, ts);
+    }
+    branch(*this, x, INT_VAR_SIZE_MIN(), INT_VAL_MIN());
+  }
+  /// Constructor for cloning \a s
+  TupleSetBench(TupleSetBench& s) : Script(s) {
+    x.update(*this, s.x);
+  }
+  /// Perform copying during cloning
+  virtual Space*
+  copy(void) {
+    return new TupleSetBench(*this);
+  }
+  /// Print solution
+  virtual void
+  print(std::ostream& os) const {
+    os << "\t" << x << std::endl;
+  }
+};
+
+/** \brief Main-function
+ *  \relates TupleSetBench
+ */
+int
+main(int argc, char* argv[]) {
+  TupleSetBenchOptions opt("TupleSetBench");
+  opt.parse(argc,argv);
+  Script::run<TupleSetBench,DFS,TupleSetBenchOptions>(opt);
+  return 0;
+}
+
+// STATISTICS: example-any
@@ -384,6 +384,8 @@ namespace Gecode {
     Driver::DoubleOption      _threads;       ///< How many threads to use
     Driver::UnsignedIntOption _c_d;           ///< Copy recomputation distance
     Driver::UnsignedIntOption _a_d;           ///< Adaptive recomputation distance
+    Driver::StringOption      _steal;         ///< Victim selection for stealing
+    Driver::UnsignedIntOption _subproblems;   ///< Number of subproblems
     Driver::UnsignedIntOption _d_l;           ///< Discrepancy limit for LDS
     Driver::UnsignedIntOption _node;          ///< Cutoff for number of nodes
     Driver::UnsignedIntOption _fail;          ///< Cutoff for number of failures
@@ -395,6 +397,7 @@ namespace Gecode {
     Driver::UnsignedIntOption _r_scale;       ///< Restart scale factor
     Driver::BoolOption        _nogoods;       ///< Whether to use no-goods
     Driver::UnsignedIntOption _nogoods_limit; ///< Limit for no-good extraction
+    Driver::UnsignedIntOption _nogoods_share; ///< Number of shared no-good paths
     Driver::DoubleOption      _relax;         ///< Probability to relax variable
     Driver::BoolOption        _interrupt;     ///< Whether to catch SIGINT
     //@}
@@ -501,6 +504,16 @@ namespace Gecode {
     /// Return adaptive recomputation distance
     unsigned int a_d(void) const;
 
+    /// Set default victim selection for work stealing
+    void steal(Search::StealMode sm);
+    /// Return victim selection for work stealing
+    Search::StealMode steal(void) const;
+
+    /// Set default number of subproblems for parallel search
+    void subproblems(unsigned int n);
+    /// Return number of subproblems for parallel search
+    unsigned int subproblems(void) const;
+
     /// Set default discrepancy limit for LDS
     void d_l(unsigned int d);
     /// Return discrepancy limit for LDS
@@ -556,6 +569,11 @@ namespace Gecode {
     /// Return depth limit for nogoods
     unsigned int nogoods_limit(void) const;
 
+    /// Set default number of nogood paths shared between threads
+    void nogoods_share(unsigned int n);
+    /// Return number of nogood paths shared between threads
+    unsigned int nogoods_share(void) const;
+
     /// Set default relax probability
     void relax(double d);
     /// Return default relax probability
@@ -590,6 +590,11 @@ namespace Gecode {
                Search::Config::threads),
       _c_d("c-d","recomputation commit distance",Search::Config::c_d),
       _a_d("a-d","recomputation adaptation distance",Search::Config::a_d),
+      _steal("steal","victim selection for work stealing",
+             Search::Config::steal),
+      _subproblems("subproblems",
+                   "number of subproblems for parallel search (0 = none)",
+                   Search::Config::subproblems),
       _d_l("d-l","discrepancy limit for LDS",Search::Config::d_l),
       _node("node","node cutoff (0 = none, solution mode)"),
       _fail("fail","failure cutoff (0 = none, solution mode)"),
@@ -604,7 +609,10 @@ namespace Gecode {
       _nogoods("nogoods","whether to use no-goods from restarts",false),
       _nogoods_limit("nogoods-limit","depth limit for no-good extraction",
                      Search::Config::nogoods_limit),
-      _relax("relax","probability for relaxing variable", 0.0),
+      _nogoods_share("nogoods-share",
+                     "number of no-good paths shared between threads",
+                     Search::Config::nogoods_share),
+      _relax("relax","initial probability for relaxing variable", 0.0),
       _interrupt("interrupt","whether to catch Ctrl-C (true) or not (false)",
                  true),
 
@@ -635,6 +643,11 @@ namespace Gecode {
     _mode.add(SM_GIST,       "gist");
     _mode.add(SM_CPPROFILER, "cpprofiler");
 
+    _steal.add(Search::STEAL_LINEAR,"linear");
+    _steal.add(Search::STEAL_ROUNDROBIN,"roundrobin");
+    _steal.add(Search::STEAL_RANDOM,"random");
+    _steal.add(Search::STEAL_RICHEST,"richest");
+
     _restart.add(RM_NONE,"none");
     _restart.add(RM_CONSTANT,"constant");
     _restart.add(RM_LINEAR,"linear");
@@ -644,11 +657,11 @@ namespace Gecode {
     add(_model); add(_symmetry); add(_propagation); add(_ipl);
     add(_branching); add(_decay); add(_seed); add(_step);
     add(_search); add(_solutions); add(_threads); add(_c_d); add(_a_d);
-    add(_d_l);
+    add(_steal); add(_subproblems); add(_d_l);
     add(_node); add(_fail); add(_time); add(_interrupt);
     add(_assets); add(_slice);
     add(_restart); add(_r_base); add(_r_scale);
-    add(_nogoods); add(_nogoods_limit);
+    add(_nogoods); add(_nogoods_limit); add(_nogoods_share);
     add(_relax);
     add(_mode); add(_iterations); add(_samples); add(_print_last);
     add(_out_file); add(_log_file); add(_trace);
@@ -315,6 +315,24 @@ namespace Gecode {
     return _a_d.value();
   }
 
+  inline void
+  Options::steal(Search::StealMode sm) {
+    _steal.value(sm);
+  }
+  inline Search::StealMode
+  Options::steal(void) const {
+    return static_cast<Search::StealMode>(_steal.value());
+  }
+
+  inline void
+  Options::subproblems(unsigned int n) {
+    _subproblems.value(n);
+  }
+  inline unsigned int
+  Options::subproblems(void) const {
+    return _subproblems.value();
+  }
+
   inline void
   Options::d_l(unsigned int d) {
     _d_l.value(d);
@@ -414,6 +432,15 @@ namespace Gecode {
     return _nogoods_limit.value();
   }
 
+  inline void
+  Options::nogoods_share(unsigned int n) {
+    _nogoods_share.value(n);
+  }
+  inline unsigned int
+  Options::nogoods_share(void) const {
+    return _nogoods_share.value();
+  }
+
   inline void
   Options::relax(double d) {
     _relax.value(d);
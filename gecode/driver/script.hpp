@@ -372,6 +372,9 @@ namespace Gecode { namespace Driver {
           so.threads = o.threads();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
+          so.steal   = o.steal();
+          so.subproblems = o.subproblems();
+          so.relax   = o.relax();
           so.d_l     = o.d_l();
           so.assets  = o.assets();
           so.slice   = o.slice();
@@ -380,6 +383,7 @@ namespace Gecode { namespace Driver {
           so.cutoff  = createCutoff(o);
           so.clone   = false;
           so.nogoods_limit = o.nogoods() ? o.nogoods_limit() : 0U;
+          so.nogoods_share = o.nogoods_share();
           if (o.interrupt())
             CombinedStop::installCtrlHandler(true);
           {
@@ -443,7 +447,15 @@ namespace Gecode { namespace Driver {
                   << "\tfailures:     " << stat.fail << endl
                   << "\trestarts:     " << stat.restart << endl
                   << "\tno-goods:     " << stat.nogood << endl
+                  << "\tshared:       " << stat.nogood_shared
+                  << " no-goods (" << stat.nogood_export << " exported, "
+                  << stat.nogood_import << " imported)" << endl
                   << "\tpeak depth:   " << stat.depth << endl
+                  << "\tsteals:       " << stat.steal_success
+                  << " (" << stat.steal_attempt << " attempts)" << endl
+                  << "\tsubproblems:  " << stat.subproblem
+                  << " (at most " << stat.subproblem_node
+                  << " nodes each)" << endl
 #ifdef GECODE_PEAKHEAP
                   << "\tpeak memory:  "
                   << static_cast<int>((heap.peak()+1023) / 1024) << " KB"
@@ -472,11 +484,15 @@ namespace Gecode { namespace Driver {
           so.slice   = o.slice();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
+          so.steal   = o.steal();
+          so.subproblems = o.subproblems();
+          so.relax   = o.relax();
           so.d_l     = o.d_l();
           so.stop    = CombinedStop::create(o.node(),o.fail(), o.time(),
                                             o.interrupt());
           so.cutoff  = createCutoff(o);
           so.nogoods_limit = o.nogoods() ? o.nogoods_limit() : 0U;
+          so.nogoods_share = o.nogoods_share();
           if (o.interrupt())
             CombinedStop::installCtrlHandler(true);
           {
@@ -503,7 +519,15 @@ namespace Gecode { namespace Driver {
                   << "\tfailures:     " << stat.fail << endl
                   << "\trestarts:     " << stat.restart << endl
                   << "\tno-goods:     " << stat.nogood << endl
+                  << "\tshared:       " << stat.nogood_shared
+                  << " no-goods (" << stat.nogood_export << " exported, "
+                  << stat.nogood_import << " imported)" << endl
                   << "\tpeak depth:   " << stat.depth << endl
+                  << "\tsteals:       " << stat.steal_success
+                  << " (" << stat.steal_attempt << " attempts)" << endl
+                  << "\tsubproblems:  " << stat.subproblem
+                  << " (at most " << stat.subproblem_node
+                  << " nodes each)" << endl
 #ifdef GECODE_PEAKHEAP
                   << "\tpeak memory:  "
                   << static_cast<int>((heap.peak()+1023) / 1024) << " KB"
@@ -532,11 +556,15 @@ namespace Gecode { namespace Driver {
               sok.slice   = o.slice();
               sok.c_d     = o.c_d();
               sok.a_d     = o.a_d();
+              sok.steal   = o.steal();
+              sok.subproblems = o.subproblems();
+              sok.relax   = o.relax();
               sok.d_l     = o.d_l();
               sok.stop    = CombinedStop::create(o.node(),o.fail(), o.time(),
                                                  false);
               sok.cutoff  = createCutoff(o);
               sok.nogoods_limit = o.nogoods() ? o.nogoods_limit() : 0U;
+              sok.nogoods_share = o.nogoods_share();
               {
                 Meta<Script,Engine> e(s1,sok);
                 do {
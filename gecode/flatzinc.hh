@@ -234,6 +234,7 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::DoubleOption      _decay;       ///< Decay option
       Gecode::Driver::UnsignedIntOption _c_d;       ///< Copy recomputation distance
       Gecode::Driver::UnsignedIntOption _a_d;       ///< Adaptive recomputation distance
+      Gecode::Driver::UnsignedIntOption _subproblems; ///< Number of subproblems for parallel search
       Gecode::Driver::UnsignedIntOption _node;      ///< Cutoff for number of nodes
       Gecode::Driver::UnsignedIntOption _fail;      ///< Cutoff for number of failures
       Gecode::Driver::UnsignedIntOption _time;      ///< Cutoff for time
@@ -244,6 +245,7 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::UnsignedIntOption _r_scale;   ///< Restart scale factor
       Gecode::Driver::BoolOption        _nogoods;   ///< Whether to use no-goods
       Gecode::Driver::UnsignedIntOption _nogoods_limit; ///< Depth limit for extracting no-goods
+      Gecode::Driver::UnsignedIntOption _nogoods_share; ///< Number of no-good paths shared between threads
       Gecode::Driver::BoolOption        _interrupt; ///< Whether to catch SIGINT
       Gecode::Driver::DoubleOption      _step;        ///< Step option
       //@}
@@ -275,6 +277,9 @@ namespace Gecode { namespace FlatZinc {
       _decay("decay","decay factor",0.99),
       _c_d("c-d","recomputation commit distance",Gecode::Search::Config::c_d),
       _a_d("a-d","recomputation adaption distance",Gecode::Search::Config::a_d),
+      _subproblems("subproblems",
+                   "number of subproblems for parallel search (0 = none)",
+                   Gecode::Search::Config::subproblems),
       _node("node","node cutoff (0 = none, solution mode)"),
       _fail("fail","failure cutoff (0 = none, solution mode)"),
       _time("time","time (in ms) cutoff (0 = none, solution mode)"),
@@ -286,6 +291,9 @@ namespace Gecode { namespace FlatZinc {
       _nogoods("nogoods","whether to use no-goods from restarts",false),
       _nogoods_limit("nogoods-limit","depth limit for no-good extraction",
                      Search::Config::nogoods_limit),
+      _nogoods_share("nogoods-share",
+                     "number of no-good paths shared between threads",
+                     Search::Config::nogoods_share),
       _interrupt("interrupt","whether to catch Ctrl-C (true) or not (false)",
                  true),
       _step("step","step distance for float optimization",0.0),
@@ -312,6 +320,7 @@ namespace Gecode { namespace FlatZinc {
       _restart.add(RM_GEOMETRIC,"geometric");
 
       add(_solutions); add(_threads); add(_c_d); add(_a_d);
+      add(_subproblems);
       add(_allSolutions);
       add(_free);
       add(_decay);
@@ -319,7 +328,7 @@ namespace Gecode { namespace FlatZinc {
       add(_seed);
       add(_step);
       add(_restart); add(_r_base); add(_r_scale);
-      add(_nogoods); add(_nogoods_limit);
+      add(_nogoods); add(_nogoods_limit); add(_nogoods_share);
       add(_mode); add(_stat);
       add(_output);
 #ifdef GECODE_HAS_CPPROFILER
@@ -354,6 +363,7 @@ namespace Gecode { namespace FlatZinc {
     bool free(void) const { return _free.value(); }
     unsigned int c_d(void) const { return _c_d.value(); }
     unsigned int a_d(void) const { return _a_d.value(); }
+    unsigned int subproblems(void) const { return _subproblems.value(); }
     unsigned int node(void) const { return _node.value(); }
     unsigned int fail(void) const { return _fail.value(); }
     unsigned int time(void) const { return _time.value(); }
@@ -378,6 +388,7 @@ namespace Gecode { namespace FlatZinc {
     void restart_scale(int i) { _r_scale.value(i); }
     bool nogoods(void) const { return _nogoods.value(); }
     unsigned int nogoods_limit(void) const { return _nogoods_limit.value(); }
+    unsigned int nogoods_share(void) const { return _nogoods_share.value(); }
     bool interrupt(void) const { return _interrupt.value(); }
 
 #ifdef GECODE_HAS_CPPROFILER
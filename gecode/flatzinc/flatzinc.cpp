@@ -51,15 +51,6 @@
 
 namespace std {
 
-  /// Hashing for tuple sets
-  template<> struct hash<Gecode::TupleSet> {
-    /// Return hash key for \a x
-    forceinline size_t
-    operator()(const Gecode::TupleSet& x) const {
-      return x.hash();
-    }
-  };
-
   /// Hashing for tuple sets
   template<> struct hash<Gecode::SharedArray<int> > {
     /// Return hash key for \a x
@@ -72,14 +63,6 @@ namespace std {
     }
   };
 
-  /// Hashing for DFAs
-  template<> struct hash<Gecode::DFA> {
-    /// Return hash key for \a d
-    forceinline size_t operator()(const Gecode::DFA& d) const {
-      return d.hash();
-    }
-  };
-
 }
 
 namespace Gecode { namespace FlatZinc {
@@ -752,21 +735,10 @@ namespace Gecode { namespace FlatZinc {
 
   class FlatZincSpaceInitData {
   public:
-    /// Hash table of tuple sets
-    typedef std::unordered_set<TupleSet> TupleSetSet;
-    /// Hash table of tuple sets
-    TupleSetSet tupleSetSet;
-
     /// Hash table of shared integer arrays
     typedef std::unordered_set<SharedArray<int> > IntSharedArraySet;
     /// Hash table of shared integer arrays
-    IntSharedArraySet intSharedArraySet;
-
-    /// Hash table of DFAs
-    typedef std::unordered_set<DFA> DFASet;
-    /// Hash table of DFAs
-    DFASet dfaSet;
-    
+    IntSharedArraySet intSharedArraySet;    
     /// Initialize
     FlatZincSpaceInitData(void) {}
   };
@@ -1858,7 +1830,11 @@ namespace Gecode { namespace FlatZinc {
     step = opt.step();
 #endif
     o.threads = opt.threads();
+    o.subproblems = opt.subproblems();
+    // Let the engine adapt the share of variables that are relaxed
+    o.relax = ((_lns > 0) && (_lns < 100)) ? (100U - _lns) / 100.0 : 0.0;
     o.nogoods_limit = opt.nogoods() ? opt.nogoods_limit() : 0;
+    o.nogoods_share = opt.nogoods_share();
     o.cutoff  = new Search::CutoffAppend(new Search::CutoffConstant(0), 1, Driver::createCutoff(opt));
     if (opt.interrupt())
       Driver::CombinedStop::installCtrlHandler(true);
@@ -1918,6 +1894,12 @@ namespace Gecode { namespace FlatZinc {
             << "%%%mzn-stat: failures=" << stat.fail << std::endl
             << "%%%mzn-stat: restarts=" << stat.restart << std::endl
             << "%%%mzn-stat: peakDepth=" << stat.depth << std::endl
+            << "%%%mzn-stat: subproblems=" << stat.subproblem << std::endl
+            << "%%%mzn-stat: nogoodsExported=" << stat.nogood_export << std::endl
+            << "%%%mzn-stat: nogoodsImported=" << stat.nogood_import << std::endl
+            << "%%%mzn-stat: nogoodsShared=" << stat.nogood_shared << std::endl
+            << "%%%mzn-stat: sharedTableBytes="
+            << intern_statistics().bytes << std::endl
             << "%%%mzn-stat-end" << std::endl
             << std::endl;
       }
@@ -2000,10 +1982,14 @@ namespace Gecode { namespace FlatZinc {
 
   bool
   FlatZincSpace::slave(const MetaInfo& mi) {
+    // Percentage of variables to keep, possibly adapted by the engine
+    unsigned int lns = _lns;
+    if ((mi.type() == MetaInfo::RESTART) && (mi.relax() > 0.0))
+      lns = static_cast<unsigned int>(100.0 * (1.0 - mi.relax()));
     if ((mi.type() == MetaInfo::RESTART) && (mi.restart() != 0) &&
         (_lns > 0) && (mi.last()==NULL) && (_lnsInitialSolution.size()>0)) {
       for (unsigned int i=iv_lns.size(); i--;) {
-        if (_random(99) <= _lns) {
+        if (_random(99) <= lns) {
           rel(*this, iv_lns[i], IRT_EQ, _lnsInitialSolution[i]);
         }
       }
@@ -2013,7 +1999,7 @@ namespace Gecode { namespace FlatZinc {
       const FlatZincSpace& last =
         static_cast<const FlatZincSpace&>(*mi.last());
       for (unsigned int i=iv_lns.size(); i--;) {
-        if (_random(99) <= _lns) {
+        if (_random(99) <= lns) {
           rel(*this, iv_lns[i], IRT_EQ, last.iv_lns[i]);
         }
       }
@@ -2143,17 +2129,8 @@ namespace Gecode { namespace FlatZinc {
       ts.add(t);
     }
     ts.finalize();
-
-    if (_initData) {
-      FlatZincSpaceInitData::TupleSetSet::iterator it = _initData->tupleSetSet.find(ts);
-      if (it != _initData->tupleSetSet.end()) {
-        return *it;
-      }
-      _initData->tupleSetSet.insert(ts);
-    }
-    
-    
-    return ts;
+    // Share identical tables across constraints and spaces
+    return intern(ts);
   }
   IntSharedArray
   FlatZincSpace::arg2intsharedarray(AST::Node* arg, int offset) {
@@ -2400,14 +2377,7 @@ namespace Gecode { namespace FlatZinc {
 
   DFA
   FlatZincSpace::getSharedDFA(DFA& a) {
-    if (_initData) {
-      FlatZincSpaceInitData::DFASet::iterator it = _initData->dfaSet.find(a);
-      if (it != _initData->dfaSet.end()) {
-        return *it;
-      }
-      _initData->dfaSet.insert(a);
-    }
-    return a;
+    return intern(a);
   }
 
   void
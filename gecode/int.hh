@@ -2037,6 +2037,10 @@ namespace Gecode {
    * see the module MiniModel.
    */
 
+  namespace Int { namespace Extensional {
+    class InternTable;
+  }}
+
   /**
    * \brief Deterministic finite automaton (%DFA)
    *
@@ -2047,6 +2051,7 @@ namespace Gecode {
    * \ingroup TaskModelIntExt
    */
   class DFA : public SharedHandle {
+    friend class Int::Extensional::InternTable;
   private:
     /// Implementation of DFA
     class DFAI;
@@ -2172,6 +2177,9 @@ namespace Gecode {
     int symbol_max(void) const;
     /// Return hash key
     std::size_t hash(void) const;
+    /// Return memory (in bytes) used by the DFA
+    GECODE_INT_EXPORT
+    std::size_t bytes(void) const;
   };
 
 }
@@ -2189,6 +2197,7 @@ namespace Gecode {
    * \ingroup TaskModelIntExt
    */
   class TupleSet : public SharedHandle {
+    friend class Int::Extensional::InternTable;
   public:
     /** \brief Type of a tuple
      *
@@ -2253,6 +2262,10 @@ namespace Gecode {
       Range* range;
       /// Pointer to all support data
       BitSetData* support;
+      /// Memory of mapped file holding tuple and support data (if any)
+      void* map;
+      /// Size of mapped memory
+      std::size_t map_size;
 
       /// Return newly added tuple
       Tuple add(void);
@@ -2313,6 +2326,19 @@ namespace Gecode {
     /// Initialize with DFA \a dfa for arity \a a
     GECODE_INT_EXPORT
     TupleSet(int a, const DFA& dfa);
+    /**
+     * \brief Initialize from file \a fn written by save()
+     *
+     * The tuples and supports are not copied but the file is mapped
+     * read-only into memory. Hence, several processes using the same
+     * file share its memory.
+     *
+     * Throws an exception of type Int::InvalidTupleSetFile, if the
+     * file cannot be read or has not been written by save() on a
+     * platform with the same data representation.
+     */
+    GECODE_INT_EXPORT
+    explicit TupleSet(const std::string& fn);
     /// Test whether tuple set has been initialized
     operator bool(void) const;
     /// Test whether tuple set is equal to \a t
@@ -2329,6 +2355,15 @@ namespace Gecode {
     bool finalized(void) const;
     /// Finalize tuple set
     void finalize(void);
+    /**
+     * \brief Save finalized tuple set to file \a fn
+     *
+     * Throws an exception of type Int::NotYetFinalized if the tuple set
+     * is not finalized and of type Int::InvalidTupleSetFile if the file
+     * cannot be written.
+     */
+    GECODE_INT_EXPORT
+    void save(const std::string& fn) const;
     //@}
 
     /// \name Tuple access
@@ -2347,6 +2382,9 @@ namespace Gecode {
     int max(void) const;
     /// Return hash key
     std::size_t hash(void) const;
+    /// Return memory (in bytes) used by the tuple set
+    GECODE_INT_EXPORT
+    std::size_t bytes(void) const;
     //@}
 
     /// \name Range access and iteration
@@ -2390,6 +2428,67 @@ namespace Gecode {
     //@}
   };
 
+  /**
+   * \brief Statistics for process-wide sharing of tuple sets and DFAs
+   *
+   * \ingroup TaskModelIntExt
+   */
+  class InternStatistics {
+  public:
+    /// Number of distinct tuple sets shared
+    unsigned long int tuplesets;
+    /// Number of distinct DFAs shared
+    unsigned long int dfas;
+    /// Number of requests answered by an already shared object
+    unsigned long int hits;
+    /// Memory (in bytes) of duplicates replaced by shared objects
+    std::size_t bytes;
+    /// Initialize
+    InternStatistics(void);
+  };
+
+  /**
+   * \brief Return tuple set equal to \a t that is shared process-wide
+   *
+   * If an equal tuple set has been interned before, it is returned
+   * (and \a t can be released by the caller), otherwise \a t is
+   * entered and returned. Lookup uses the hash key of the tuple set.
+   * Interning is thread-safe.
+   *
+   * Throws an exception of type Int::NotYetFinalized, if the tuple set
+   * \a t has not been finalized.
+   *
+   * \ingroup TaskModelIntExt
+   */
+  GECODE_INT_EXPORT TupleSet
+  intern(const TupleSet& t);
+
+  /**
+   * \brief Return DFA equal to \a d that is shared process-wide
+   *
+   * \ingroup TaskModelIntExt
+   */
+  GECODE_INT_EXPORT DFA
+  intern(const DFA& d);
+
+  /**
+   * \brief Return statistics for interned tuple sets and DFAs
+   *
+   * \ingroup TaskModelIntExt
+   */
+  GECODE_INT_EXPORT InternStatistics
+  intern_statistics(void);
+
+  /**
+   * \brief Release all interned tuple sets and DFAs
+   *
+   * Tuple sets and DFAs still in use elsewhere remain valid.
+   *
+   * \ingroup TaskModelIntExt
+   */
+  GECODE_INT_EXPORT void
+  intern_clear(void);
+
 }
 
 #include <gecode/int/extensional/tuple-set.hpp>
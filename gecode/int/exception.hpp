@@ -146,6 +146,13 @@ namespace Gecode { namespace Int {
     AlreadyFinalized(const char* l);
   };
 
+  /// %Exception: Tuple set file cannot be accessed or is invalid
+  class GECODE_INT_EXPORT InvalidTupleSetFile : public Exception {
+  public:
+    /// Initialize with location \a l
+    InvalidTupleSetFile(const char* l);
+  };
+
   /// %Exception: Variable in symmetry not branched on
   class GECODE_INT_EXPORT LDSBUnbranchedVariable : public Exception {
   public:
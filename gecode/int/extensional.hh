@@ -230,6 +230,54 @@ namespace Gecode { namespace Int { namespace Extensional {
    */
   template<unsigned int size> class TinyBitSet;
 
+  /**
+   * \brief Vectorized operations on words of sparse bit-sets
+   *
+   * The operations combine the words \a w of a bit-set with the words
+   * of a mask \a b that are selected by the indices \a x of the
+   * bit-set. They are implemented for AVX-512, AVX2, and portably.
+   * Which implementation is used is decided once at run time depending
+   * on the instruction sets supported by the processor.
+   *
+   * The operations that modify \a w return whether some word has
+   * become empty.
+   */
+  class BitSetOps {
+  public:
+    /// Minimal number of words for which the operations are used
+    static const unsigned int min_words = 4U;
+    /// Set \a w[i] to \a w[i] | \a b[\a x[i]] for \a i < \a n
+    template<class IndexType>
+    GECODE_INT_EXPORT static void
+    or_gather(BitSetData* w, const BitSetData* b, const IndexType* x,
+              unsigned int n);
+    /// Set \a w[i] to \a w[i] & \a b[\a x[i]] for \a i < \a n
+    template<class IndexType>
+    GECODE_INT_EXPORT static bool
+    and_gather(BitSetData* w, const BitSetData* b, const IndexType* x,
+               unsigned int n);
+    /// Set \a w[i] to \a w[i] & (\a a[\a x[i]] | \a b[\a x[i]]) for \a i < \a n
+    template<class IndexType>
+    GECODE_INT_EXPORT static bool
+    and_or_gather(BitSetData* w, const BitSetData* a, const BitSetData* b,
+                  const IndexType* x, unsigned int n);
+    /// Set \a w[i] to \a w[i] & ~\a b[\a x[i]] for \a i < \a n
+    template<class IndexType>
+    GECODE_INT_EXPORT static bool
+    andnot_gather(BitSetData* w, const BitSetData* b, const IndexType* x,
+                  unsigned int n);
+    /// Test whether \a w[i] & \a b[\a x[i]] is not empty for some \a i < \a n
+    template<class IndexType>
+    GECODE_INT_EXPORT static bool
+    intersects_gather(const BitSetData* w, const BitSetData* b,
+                      const IndexType* x, unsigned int n);
+    /// Set \a w[i] to \a w[i] & \a b[\a i] for \a i < \a n
+    GECODE_INT_EXPORT static bool
+    and_dense(BitSetData* w, const BitSetData* b, unsigned int n);
+    /// Return the name of the selected implementation
+    GECODE_INT_EXPORT static const char* name(void);
+  };
+
   /// Bit-set
   template<class IndexType>
   class BitSet {
@@ -244,6 +292,8 @@ namespace Gecode { namespace Int { namespace Extensional {
     BitSetData* _bits;
     /// Replace the \a i th word with \a w, decrease \a limit if \a w is zero
     void replace_and_decrease(IndexType i, BitSetData w);
+    /// Remove all zero words
+    void compact(void);
   public:
     /// Initialize bit set for a number of words \a n
     BitSet(Space& home, unsigned int n);
@@ -0,0 +1,558 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int/extensional.hh>
+
+#include <cstring>
+
+/*
+ * Vectorized implementations are only available for 64 bit x86
+ * processors and compilers that support selecting the instruction
+ * set per function.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__) && \
+  !defined(__INTEL_COMPILER)
+#define GECODE_INT_BITSET_X86
+#include <immintrin.h>
+#endif
+
+namespace Gecode { namespace Int { namespace Extensional {
+
+  namespace {
+
+    /*
+     * Portable implementation
+     *
+     */
+
+    template<class IndexType>
+    void
+    or_gather_portable(BitSetData* w, const BitSetData* b,
+                       const IndexType* x, unsigned int n) {
+      for (unsigned int i=0U; i<n; i++)
+        w[i] = BitSetData::o(w[i],b[x[i]]);
+    }
+
+    template<class IndexType>
+    bool
+    and_gather_portable(BitSetData* w, const BitSetData* b,
+                        const IndexType* x, unsigned int n) {
+      bool z = false;
+      for (unsigned int i=0U; i<n; i++) {
+        w[i] = BitSetData::a(w[i],b[x[i]]);
+        z |= w[i].none();
+      }
+      return z;
+    }
+
+    template<class IndexType>
+    bool
+    and_or_gather_portable(BitSetData* w, const BitSetData* a,
+                           const BitSetData* b,
+                           const IndexType* x, unsigned int n) {
+      bool z = false;
+      for (unsigned int i=0U; i<n; i++) {
+        w[i] = BitSetData::a(w[i],BitSetData::o(a[x[i]],b[x[i]]));
+        z |= w[i].none();
+      }
+      return z;
+    }
+
+    template<class IndexType>
+    bool
+    andnot_gather_portable(BitSetData* w, const BitSetData* b,
+                           const IndexType* x, unsigned int n) {
+      bool z = false;
+      for (unsigned int i=0U; i<n; i++) {
+        w[i] = BitSetData::a(w[i],~b[x[i]]);
+        z |= w[i].none();
+      }
+      return z;
+    }
+
+    template<class IndexType>
+    bool
+    intersects_gather_portable(const BitSetData* w, const BitSetData* b,
+                               const IndexType* x, unsigned int n) {
+      for (unsigned int i=0U; i<n; i++)
+        if (!BitSetData::a(w[i],b[x[i]]).none())
+          return true;
+      return false;
+    }
+
+    bool
+    and_dense_portable(BitSetData* w, const BitSetData* b, unsigned int n) {
+      bool z = false;
+      for (unsigned int i=0U; i<n; i++) {
+        w[i] = BitSetData::a(w[i],b[i]);
+        z |= w[i].none();
+      }
+      return z;
+    }
+
+
+#ifdef GECODE_INT_BITSET_X86
+
+    /*
+     * AVX2 implementation: four words at a time
+     *
+     */
+
+    /// Load four indices starting at \a x as 32 bit integers
+    __attribute__((target("avx2"))) inline __m128i
+    load4(const unsigned char* x) {
+      int v; std::memcpy(&v,x,sizeof(int));
+      return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(v));
+    }
+    __attribute__((target("avx2"))) inline __m128i
+    load4(const unsigned short int* x) {
+      return _mm_cvtepu16_epi32
+        (_mm_loadl_epi64(reinterpret_cast<const __m128i*>(x)));
+    }
+    __attribute__((target("avx2"))) inline __m128i
+    load4(const unsigned int* x) {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i*>(x));
+    }
+
+    /// Gather the four words of \a b selected by the indices at \a x
+    template<class IndexType>
+    __attribute__((target("avx2"))) inline __m256i
+    gather4(const BitSetData* b, const IndexType* x) {
+      return _mm256_i32gather_epi64
+        (reinterpret_cast<const long long int*>(b),load4(x),8);
+    }
+    /// Load four words starting at \a w
+    __attribute__((target("avx2"))) inline __m256i
+    load4(const BitSetData* w) {
+      return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w));
+    }
+    /// Store four words \a v starting at \a w
+    __attribute__((target("avx2"))) inline void
+    store4(BitSetData* w, __m256i v) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(w),v);
+    }
+    /// Return which of the four words in \a v are zero
+    __attribute__((target("avx2"))) inline __m256i
+    zero4(__m256i v) {
+      return _mm256_cmpeq_epi64(v,_mm256_setzero_si256());
+    }
+    /// Test whether some bit in \a v is set
+    __attribute__((target("avx2"))) inline bool
+    any4(__m256i v) {
+      return !_mm256_testz_si256(v,v);
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx2"))) void
+    or_gather_avx2(BitSetData* w, const BitSetData* b,
+                   const IndexType* x, unsigned int n) {
+      unsigned int i=0U;
+      for (; i+4U<=n; i+=4U)
+        store4(w+i,_mm256_or_si256(load4(w+i),gather4(b,x+i)));
+      or_gather_portable(w+i,b,x+i,n-i);
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx2"))) bool
+    and_gather_avx2(BitSetData* w, const BitSetData* b,
+                    const IndexType* x, unsigned int n) {
+      __m256i z = _mm256_setzero_si256();
+      unsigned int i=0U;
+      for (; i+4U<=n; i+=4U) {
+        __m256i v = _mm256_and_si256(load4(w+i),gather4(b,x+i));
+        store4(w+i,v);
+        z = _mm256_or_si256(z,zero4(v));
+      }
+      return and_gather_portable(w+i,b,x+i,n-i) || any4(z);
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx2"))) bool
+    and_or_gather_avx2(BitSetData* w, const BitSetData* a,
+                       const BitSetData* b,
+                       const IndexType* x, unsigned int n) {
+      __m256i z = _mm256_setzero_si256();
+      unsigned int i=0U;
+      for (; i+4U<=n; i+=4U) {
+        __m256i o = _mm256_or_si256(gather4(a,x+i),gather4(b,x+i));
+        __m256i v = _mm256_and_si256(load4(w+i),o);
+        store4(w+i,v);
+        z = _mm256_or_si256(z,zero4(v));
+      }
+      return and_or_gather_portable(w+i,a,b,x+i,n-i) || any4(z);
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx2"))) bool
+    andnot_gather_avx2(BitSetData* w, const BitSetData* b,
+                       const IndexType* x, unsigned int n) {
+      __m256i z = _mm256_setzero_si256();
+      unsigned int i=0U;
+      for (; i+4U<=n; i+=4U) {
+        __m256i v = _mm256_andnot_si256(gather4(b,x+i),load4(w+i));
+        store4(w+i,v);
+        z = _mm256_or_si256(z,zero4(v));
+      }
+      return andnot_gather_portable(w+i,b,x+i,n-i) || any4(z);
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx2"))) bool
+    intersects_gather_avx2(const BitSetData* w, const BitSetData* b,
+                           const IndexType* x, unsigned int n) {
+      unsigned int i=0U;
+      for (; i+4U<=n; i+=4U)
+        if (!_mm256_testz_si256(load4(w+i),gather4(b,x+i)))
+          return true;
+      return intersects_gather_portable(w+i,b,x+i,n-i);
+    }
+
+    __attribute__((target("avx2"))) bool
+    and_dense_avx2(BitSetData* w, const BitSetData* b, unsigned int n) {
+      __m256i z = _mm256_setzero_si256();
+      unsigned int i=0U;
+      for (; i+4U<=n; i+=4U) {
+        __m256i v = _mm256_and_si256(load4(w+i),load4(b+i));
+        store4(w+i,v);
+        z = _mm256_or_si256(z,zero4(v));
+      }
+      return and_dense_portable(w+i,b+i,n-i) || any4(z);
+    }
+
+
+    /*
+     * AVX-512 implementation: eight words at a time
+     *
+     */
+
+    /// Load eight indices starting at \a x as 32 bit integers
+    __attribute__((target("avx512f"))) inline __m256i
+    load8(const unsigned char* x) {
+      return _mm256_cvtepu8_epi32
+        (_mm_loadl_epi64(reinterpret_cast<const __m128i*>(x)));
+    }
+    __attribute__((target("avx512f"))) inline __m256i
+    load8(const unsigned short int* x) {
+      return _mm256_cvtepu16_epi32
+        (_mm_loadu_si128(reinterpret_cast<const __m128i*>(x)));
+    }
+    __attribute__((target("avx512f"))) inline __m256i
+    load8(const unsigned int* x) {
+      return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x));
+    }
+
+    /// Gather the eight words of \a b selected by the indices at \a x
+    template<class IndexType>
+    __attribute__((target("avx512f"))) inline __m512i
+    gather8(const BitSetData* b, const IndexType* x) {
+      return _mm512_i32gather_epi64(load8(x),b,8);
+    }
+    /// Load eight words starting at \a w
+    __attribute__((target("avx512f"))) inline __m512i
+    load8(const BitSetData* w) {
+      return _mm512_loadu_si512(w);
+    }
+    /// Store eight words \a v starting at \a w
+    __attribute__((target("avx512f"))) inline void
+    store8(BitSetData* w, __m512i v) {
+      _mm512_storeu_si512(w,v);
+    }
+    /// Return a mask for which of the eight words in \a v are not zero
+    __attribute__((target("avx512f"))) inline __mmask8
+    nonzero8(__m512i v) {
+      return _mm512_test_epi64_mask(v,v);
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx512f"))) void
+    or_gather_avx512(BitSetData* w, const BitSetData* b,
+                     const IndexType* x, unsigned int n) {
+      unsigned int i=0U;
+      for (; i+8U<=n; i+=8U)
+        store8(w+i,_mm512_or_si512(load8(w+i),gather8(b,x+i)));
+      or_gather_avx2(w+i,b,x+i,n-i);
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx512f"))) bool
+    and_gather_avx512(BitSetData* w, const BitSetData* b,
+                      const IndexType* x, unsigned int n) {
+      __mmask8 nz = 0xff;
+      unsigned int i=0U;
+      for (; i+8U<=n; i+=8U) {
+        __m512i v = _mm512_and_si512(load8(w+i),gather8(b,x+i));
+        store8(w+i,v);
+        nz &= nonzero8(v);
+      }
+      return and_gather_avx2(w+i,b,x+i,n-i) || (nz != 0xff);
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx512f"))) bool
+    and_or_gather_avx512(BitSetData* w, const BitSetData* a,
+                         const BitSetData* b,
+                         const IndexType* x, unsigned int n) {
+      __mmask8 nz = 0xff;
+      unsigned int i=0U;
+      for (; i+8U<=n; i+=8U) {
+        __m512i o = _mm512_or_si512(gather8(a,x+i),gather8(b,x+i));
+        __m512i v = _mm512_and_si512(load8(w+i),o);
+        store8(w+i,v);
+        nz &= nonzero8(v);
+      }
+      return and_or_gather_avx2(w+i,a,b,x+i,n-i) || (nz != 0xff);
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx512f"))) bool
+    andnot_gather_avx512(BitSetData* w, const BitSetData* b,
+                         const IndexType* x, unsigned int n) {
+      __mmask8 nz = 0xff;
+      unsigned int i=0U;
+      for (; i+8U<=n; i+=8U) {
+        __m512i v = _mm512_andnot_si512(gather8(b,x+i),load8(w+i));
+        store8(w+i,v);
+        nz &= nonzero8(v);
+      }
+      return andnot_gather_avx2(w+i,b,x+i,n-i) || (nz != 0xff);
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx512f"))) bool
+    intersects_gather_avx512(const BitSetData* w, const BitSetData* b,
+                             const IndexType* x, unsigned int n) {
+      unsigned int i=0U;
+      for (; i+8U<=n; i+=8U)
+        if (_mm512_test_epi64_mask(load8(w+i),gather8(b,x+i)) != 0)
+          return true;
+      return intersects_gather_avx2(w+i,b,x+i,n-i);
+    }
+
+    __attribute__((target("avx512f"))) bool
+    and_dense_avx512(BitSetData* w, const BitSetData* b, unsigned int n) {
+      __mmask8 nz = 0xff;
+      unsigned int i=0U;
+      for (; i+8U<=n; i+=8U) {
+        __m512i v = _mm512_and_si512(load8(w+i),load8(b+i));
+        store8(w+i,v);
+        nz &= nonzero8(v);
+      }
+      return and_dense_avx2(w+i,b+i,n-i) || (nz != 0xff);
+    }
+
+#endif
+
+
+    /*
+     * Selecting the implementation
+     *
+     */
+
+    /// Operations for a particular index type
+    template<class IndexType>
+    class Ops {
+    public:
+      /// Or-gather operation
+      void (*or_gather)(BitSetData*, const BitSetData*,
+                        const IndexType*, unsigned int);
+      /// And-gather operation
+      bool (*and_gather)(BitSetData*, const BitSetData*,
+                         const IndexType*, unsigned int);
+      /// And-or-gather operation
+      bool (*and_or_gather)(BitSetData*, const BitSetData*,
+                            const BitSetData*,
+                            const IndexType*, unsigned int);
+      /// Andnot-gather operation
+      bool (*andnot_gather)(BitSetData*, const BitSetData*,
+                            const IndexType*, unsigned int);
+      /// Intersects-gather operation
+      bool (*intersects_gather)(const BitSetData*, const BitSetData*,
+                                const IndexType*, unsigned int);
+    };
+
+    /// Define operations for index type \a IndexType and implementation \a I
+#define GECODE_INT_BITSET_OPS(IndexType,I)                          \
+    { &or_gather_##I<IndexType>, &and_gather_##I<IndexType>,        \
+      &and_or_gather_##I<IndexType>, &andnot_gather_##I<IndexType>, \
+      &intersects_gather_##I<IndexType> }
+
+    /*
+     * The portable operations are used until the implementation
+     * has been selected (static initialization happens before
+     * dynamic initialization).
+     */
+    /// Operations for 8 bit indices
+    Ops<unsigned char> ops_uc =
+      GECODE_INT_BITSET_OPS(unsigned char,portable);
+    /// Operations for 16 bit indices
+    Ops<unsigned short int> ops_us =
+      GECODE_INT_BITSET_OPS(unsigned short int,portable);
+    /// Operations for 32 bit indices
+    Ops<unsigned int> ops_ui =
+      GECODE_INT_BITSET_OPS(unsigned int,portable);
+    /// Dense and operation
+    bool (*ops_and_dense)(BitSetData*, const BitSetData*, unsigned int) =
+      &and_dense_portable;
+    /// Name of the selected implementation
+    const char* ops_name = "portable";
+
+    /// Return operations for index type \a IndexType
+    forceinline const Ops<unsigned char>&
+    ops(const unsigned char*) {
+      return ops_uc;
+    }
+    forceinline const Ops<unsigned short int>&
+    ops(const unsigned short int*) {
+      return ops_us;
+    }
+    forceinline const Ops<unsigned int>&
+    ops(const unsigned int*) {
+      return ops_ui;
+    }
+
+    /// Select the implementation when the library is loaded
+    class Select {
+    public:
+      /// Perform selection
+      Select(void) {
+#ifdef GECODE_INT_BITSET_X86
+        if (sizeof(BitSetData) != sizeof(long long int))
+          return;
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+          Ops<unsigned char> uc =
+            GECODE_INT_BITSET_OPS(unsigned char,avx512);
+          Ops<unsigned short int> us =
+            GECODE_INT_BITSET_OPS(unsigned short int,avx512);
+          Ops<unsigned int> ui =
+            GECODE_INT_BITSET_OPS(unsigned int,avx512);
+          ops_uc = uc; ops_us = us; ops_ui = ui;
+          ops_and_dense = &and_dense_avx512;
+          ops_name = "avx512";
+        } else if (__builtin_cpu_supports("avx2")) {
+          Ops<unsigned char> uc =
+            GECODE_INT_BITSET_OPS(unsigned char,avx2);
+          Ops<unsigned short int> us =
+            GECODE_INT_BITSET_OPS(unsigned short int,avx2);
+          Ops<unsigned int> ui =
+            GECODE_INT_BITSET_OPS(unsigned int,avx2);
+          ops_uc = uc; ops_us = us; ops_ui = ui;
+          ops_and_dense = &and_dense_avx2;
+          ops_name = "avx2";
+        }
+#endif
+      }
+    };
+
+    /// The selection
+    Select select;
+
+#undef GECODE_INT_BITSET_OPS
+
+  }
+
+  template<class IndexType>
+  void
+  BitSetOps::or_gather(BitSetData* w, const BitSetData* b,
+                       const IndexType* x, unsigned int n) {
+    ops(x).or_gather(w,b,x,n);
+  }
+
+  template<class IndexType>
+  bool
+  BitSetOps::and_gather(BitSetData* w, const BitSetData* b,
+                        const IndexType* x, unsigned int n) {
+    return ops(x).and_gather(w,b,x,n);
+  }
+
+  template<class IndexType>
+  bool
+  BitSetOps::and_or_gather(BitSetData* w, const BitSetData* a,
+                           const BitSetData* b,
+                           const IndexType* x, unsigned int n) {
+    return ops(x).and_or_gather(w,a,b,x,n);
+  }
+
+  template<class IndexType>
+  bool
+  BitSetOps::andnot_gather(BitSetData* w, const BitSetData* b,
+                           const IndexType* x, unsigned int n) {
+    return ops(x).andnot_gather(w,b,x,n);
+  }
+
+  template<class IndexType>
+  bool
+  BitSetOps::intersects_gather(const BitSetData* w, const BitSetData* b,
+                               const IndexType* x, unsigned int n) {
+    return ops(x).intersects_gather(w,b,x,n);
+  }
+
+  bool
+  BitSetOps::and_dense(BitSetData* w, const BitSetData* b, unsigned int n) {
+    return ops_and_dense(w,b,n);
+  }
+
+  const char*
+  BitSetOps::name(void) {
+    return ops_name;
+  }
+
+  /// Instantiate operations for index type \a IndexType
+#define GECODE_INT_BITSET_INSTANTIATE(IndexType)                        \
+  template void                                                         \
+  BitSetOps::or_gather<IndexType>(BitSetData*, const BitSetData*,       \
+                                  const IndexType*, unsigned int);      \
+  template bool                                                         \
+  BitSetOps::and_gather<IndexType>(BitSetData*, const BitSetData*,      \
+                                   const IndexType*, unsigned int);     \
+  template bool                                                         \
+  BitSetOps::and_or_gather<IndexType>(BitSetData*, const BitSetData*,   \
+                                      const BitSetData*,                \
+                                      const IndexType*, unsigned int);  \
+  template bool                                                         \
+  BitSetOps::andnot_gather<IndexType>(BitSetData*, const BitSetData*,   \
+                                      const IndexType*, unsigned int);  \
+  template bool                                                         \
+  BitSetOps::intersects_gather<IndexType>(const BitSetData*,            \
+                                          const BitSetData*,            \
+                                          const IndexType*, unsigned int);
+
+  GECODE_INT_BITSET_INSTANTIATE(unsigned char)
+  GECODE_INT_BITSET_INSTANTIATE(unsigned short int)
+  GECODE_INT_BITSET_INSTANTIATE(unsigned int)
+
+#undef GECODE_INT_BITSET_INSTANTIATE
+
+}}}
+
+// STATISTICS: int-prop
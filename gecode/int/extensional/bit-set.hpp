@@ -144,6 +144,18 @@ namespace Gecode { namespace Int { namespace Extensional {
     }
   }
 
+  template<class IndexType>
+  forceinline void
+  BitSet<IndexType>::compact(void) {
+    // Same order of removal as in replace_and_decrease
+    for (IndexType i = _limit; i--; )
+      if (_bits[i].none()) {
+        _limit--;
+        _bits[i] = _bits[_limit];
+        _index[i] = _index[_limit];
+      }
+  }
+
   template<class IndexType>
   forceinline void
   BitSet<IndexType>::clear_mask(BitSetData* mask) const {
@@ -158,6 +170,10 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::add_to_mask(const BitSetData* b, BitSetData* mask) const {
     assert(_limit > 0U);
+    if (_limit >= BitSetOps::min_words) {
+      BitSetOps::or_gather(mask,b,_index,_limit);
+      return;
+    }
     for (IndexType i=0; i<_limit; i++)
       mask[i] = BitSetData::o(mask[i],b[_index[i]]);
   }
@@ -167,6 +183,12 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::intersect_with_mask(const BitSetData* mask) {
     assert(_limit > 0U);
+    if (_limit >= BitSetOps::min_words) {
+      if (sparse ? BitSetOps::and_gather(_bits,mask,_index,_limit) :
+                   BitSetOps::and_dense(_bits,mask,_limit))
+        compact();
+      return;
+    }
     if (sparse) {
       for (IndexType i = _limit; i--; ) {
         assert(!_bits[i].none());
@@ -191,6 +213,11 @@ namespace Gecode { namespace Int { namespace Extensional {
   BitSet<IndexType>::intersect_with_masks(const BitSetData* a,
                                           const BitSetData* b) {
     assert(_limit > 0U);
+    if (_limit >= BitSetOps::min_words) {
+      if (BitSetOps::and_or_gather(_bits,a,b,_index,_limit))
+        compact();
+      return;
+    }
     for (IndexType i = _limit; i--; ) {
       assert(!_bits[i].none());
       BitSetData w_i = _bits[i];
@@ -206,6 +233,11 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::nand_with_mask(const BitSetData* b) {
     assert(_limit > 0U);
+    if (_limit >= BitSetOps::min_words) {
+      if (BitSetOps::andnot_gather(_bits,b,_index,_limit))
+        compact();
+      return;
+    }
     for (IndexType i = _limit; i--; ) {
       assert(!_bits[i].none());
       BitSetData w = BitSetData::a(_bits[i],~(b[_index[i]]));
@@ -217,6 +249,8 @@ namespace Gecode { namespace Int { namespace Extensional {
   template<class IndexType>
   forceinline bool
   BitSet<IndexType>::intersects(const BitSetData* b) const {
+    if (_limit >= BitSetOps::min_words)
+      return BitSetOps::intersects_gather(_bits,b,_index,_limit);
     for (IndexType i=0; i<_limit; i++)
       if (!BitSetData::a(_bits[i],b[_index[i]]).none())
         return true;
@@ -519,6 +519,15 @@ namespace Gecode {
     return true;
   }
 
+  std::size_t
+  DFA::bytes(void) const {
+    const DFAI* d = static_cast<DFAI*>(object());
+    if (d == NULL)
+      return 0U;
+    return sizeof(DFAI) + d->n_trans * sizeof(Transition) +
+      (static_cast<std::size_t>(1) << d->n_log) * sizeof(DFAI::HashEntry);
+  }
+
 }
 
 // STATISTICS: int-prop
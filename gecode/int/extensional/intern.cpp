@@ -0,0 +1,153 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/int.hh>
+
+#include <unordered_set>
+
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /// Hashing for tuple sets
+  class TupleSetHash {
+  public:
+    /// Return hash key for \a t
+    forceinline std::size_t
+    operator ()(const TupleSet& t) const {
+      return t.hash();
+    }
+  };
+
+  /// Hashing for DFAs
+  class DFAHash {
+  public:
+    /// Return hash key for \a d
+    forceinline std::size_t
+    operator ()(const DFA& d) const {
+      return d.hash();
+    }
+  };
+
+  /// Process-wide table of interned tuple sets and DFAs
+  class InternTable {
+  public:
+    /// Test whether \a x and \a y share the same implementation
+    static bool same(const TupleSet& x, const TupleSet& y) {
+      return x.object() == y.object();
+    }
+    /// Test whether \a x and \a y share the same implementation
+    static bool same(const DFA& x, const DFA& y) {
+      return x.object() == y.object();
+    }
+    /// Mutex for synchronizing access
+    Support::Mutex m;
+    /// Interned tuple sets
+    std::unordered_set<TupleSet,TupleSetHash> ts;
+    /// Interned DFAs
+    std::unordered_set<DFA,DFAHash> dfa;
+    /// Statistics
+    InternStatistics stat;
+  };
+
+  namespace {
+    /// Return the table (never deleted, as it may outlive the heap)
+    InternTable&
+    table(void) {
+      static InternTable* t = new InternTable;
+      return *t;
+    }
+  }
+
+}}}
+
+namespace Gecode {
+
+  TupleSet
+  intern(const TupleSet& t) {
+    using namespace Int::Extensional;
+    if (!t.finalized())
+      throw Int::NotYetFinalized("Int::intern");
+    InternTable& it = table();
+    Support::Lock l(it.m);
+    auto i = it.ts.find(t);
+    if (i != it.ts.end()) {
+      if (!InternTable::same(*i,t)) {
+        it.stat.hits++;
+        it.stat.bytes += t.bytes();
+      }
+      return *i;
+    }
+    it.ts.insert(t);
+    it.stat.tuplesets++;
+    return t;
+  }
+
+  DFA
+  intern(const DFA& d) {
+    using namespace Int::Extensional;
+    InternTable& it = table();
+    Support::Lock l(it.m);
+    auto i = it.dfa.find(d);
+    if (i != it.dfa.end()) {
+      if (!InternTable::same(*i,d)) {
+        it.stat.hits++;
+        it.stat.bytes += d.bytes();
+      }
+      return *i;
+    }
+    it.dfa.insert(d);
+    it.stat.dfas++;
+    return d;
+  }
+
+  InternStatistics
+  intern_statistics(void) {
+    using namespace Int::Extensional;
+    InternTable& it = table();
+    Support::Lock l(it.m);
+    return it.stat;
+  }
+
+  void
+  intern_clear(void) {
+    using namespace Int::Extensional;
+    InternTable& it = table();
+    Support::Lock l(it.m);
+    it.ts.clear();
+    it.dfa.clear();
+    it.stat = InternStatistics();
+  }
+
+}
+
+// STATISTICS: int-prop
@@ -37,6 +37,16 @@
 
 #include <gecode/int.hh>
 #include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define GECODE_INT_TUPLESET_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace Gecode { namespace Int { namespace Extensional {
 
@@ -252,10 +262,19 @@ namespace Gecode {
   }
 
   TupleSet::Data::~Data(void) {
-    heap.rfree(td);
+    if (map != nullptr) {
+      // Tuples and supports are part of the mapped file
+#ifdef GECODE_INT_TUPLESET_MMAP
+      (void) ::munmap(map, map_size);
+#else
+      heap.rfree(map);
+#endif
+    } else {
+      heap.rfree(td);
+      heap.rfree(support);
+    }
     heap.rfree(vd);
     heap.rfree(range);
-    heap.rfree(support);
   }
 
 
@@ -456,6 +475,275 @@ namespace Gecode {
     return true;
   }
 
+
+  /*
+   * Persistent tuple sets
+   *
+   */
+  namespace {
+
+    /// Header of a file storing a finalized tuple set
+    class TupleSetFileHeader {
+    public:
+      /// Magic string identifying the file format
+      char magic[8];
+      /// Version of the file format
+      unsigned int version;
+      /// Byte order mark to detect incompatible platforms
+      unsigned int bom;
+      /// Size of a bit-set word
+      unsigned int word_size;
+      /// Arity
+      int arity;
+      /// Number of words for support
+      unsigned int n_words;
+      /// Number of tuples
+      int n_tuples;
+      /// Smallest value
+      int min;
+      /// Largest value
+      int max;
+      /// Total number of ranges
+      unsigned int n_ranges;
+      /// Total number of values
+      unsigned int n_vals;
+      /// Hash key
+      unsigned long long int key;
+    };
+
+    /// Magic string of the file format
+    const char tsf_magic[8] = "GCDTSET";
+    /// Version of the file format
+    const unsigned int tsf_version = 1U;
+    /// Byte order mark
+    const unsigned int tsf_bom = 0x01020304U;
+
+    /// Round \a n up to a multiple of eight bytes
+    forceinline std::size_t
+    tsf_align(std::size_t n) {
+      return (n + 7U) & ~static_cast<std::size_t>(7U);
+    }
+
+    /// Layout of the sections of a tuple set file
+    class TupleSetFileLayout {
+    public:
+      /// Offset of the number of ranges per position
+      std::size_t n;
+      /// Offset of the range bounds
+      std::size_t r;
+      /// Offset of the tuples
+      std::size_t td;
+      /// Offset of the supports
+      std::size_t s;
+      /// Total size of the file
+      std::size_t size;
+      /// Compute layout for header \a h
+      TupleSetFileLayout(const TupleSetFileHeader& h) {
+        n = tsf_align(sizeof(TupleSetFileHeader));
+        r = n + sizeof(unsigned int) * static_cast<std::size_t>(h.arity);
+        td = tsf_align(r + 2U * sizeof(int) * h.n_ranges);
+        s = tsf_align(td + sizeof(int) *
+                      static_cast<std::size_t>(h.n_tuples) *
+                      static_cast<std::size_t>(h.arity));
+        size = s + sizeof(Support::BitSetData) *
+          static_cast<std::size_t>(h.n_words) * h.n_vals;
+      }
+    };
+
+  }
+
+  void
+  TupleSet::save(const std::string& fn) const {
+    if (!*this)
+      throw Int::UninitializedTupleSet("TupleSet::save()");
+    if (!raw().finalized())
+      throw Int::NotYetFinalized("TupleSet::save()");
+    const Data& d = raw();
+    TupleSetFileHeader h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, tsf_magic, sizeof(tsf_magic));
+    h.version = tsf_version;
+    h.bom = tsf_bom;
+    h.word_size = sizeof(BitSetData);
+    h.arity = d.arity;
+    h.n_words = d.n_words;
+    h.n_tuples = d.n_tuples;
+    h.min = d.min;
+    h.max = d.max;
+    h.n_ranges = 0U;
+    h.n_vals = 0U;
+    if (d.n_tuples > 0)
+      for (int a=0; a<d.arity; a++) {
+        h.n_ranges += d.vd[a].n;
+        for (unsigned int i=0U; i<d.vd[a].n; i++)
+          h.n_vals += d.vd[a].r[i].width();
+      }
+    h.key = static_cast<unsigned long long int>(d.key);
+    TupleSetFileLayout l(h);
+
+    std::ofstream os(fn.c_str(), std::ios::out | std::ios::binary |
+                     std::ios::trunc);
+    if (!os)
+      throw Int::InvalidTupleSetFile("TupleSet::save()");
+    // Pad the output with zeros up to offset o
+    auto pad = [&os](std::size_t o) {
+      static const char zero[8] = {0,0,0,0,0,0,0,0};
+      std::size_t p = static_cast<std::size_t>(os.tellp());
+      assert(o >= p);
+      os.write(zero, static_cast<std::streamsize>(o - p));
+    };
+    os.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    pad(l.n);
+    for (int a=0; a<d.arity; a++) {
+      unsigned int n = (d.n_tuples > 0) ? d.vd[a].n : 0U;
+      os.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    }
+    for (int a=0; a<d.arity; a++)
+      for (unsigned int i=0U; i<((d.n_tuples > 0) ? d.vd[a].n : 0U); i++) {
+        int mm[2] = {d.vd[a].r[i].min, d.vd[a].r[i].max};
+        os.write(reinterpret_cast<const char*>(&mm[0]), sizeof(mm));
+      }
+    pad(l.td);
+    os.write(reinterpret_cast<const char*>(d.td),
+             static_cast<std::streamsize>(l.s - l.td));
+    pad(l.s);
+    os.write(reinterpret_cast<const char*>(d.support),
+             static_cast<std::streamsize>(l.size - l.s));
+    os.close();
+    if (!os)
+      throw Int::InvalidTupleSetFile("TupleSet::save()");
+  }
+
+  TupleSet::TupleSet(const std::string& fn) {
+    // Map or read the entire file
+    void* m;
+    std::size_t size;
+#ifdef GECODE_INT_TUPLESET_MMAP
+    {
+      int fd = ::open(fn.c_str(), O_RDONLY);
+      if (fd < 0)
+        throw Int::InvalidTupleSetFile("TupleSet::TupleSet()");
+      struct stat st;
+      if ((::fstat(fd, &st) != 0) ||
+          (static_cast<std::size_t>(st.st_size) <
+           sizeof(TupleSetFileHeader))) {
+        (void) ::close(fd);
+        throw Int::InvalidTupleSetFile("TupleSet::TupleSet()");
+      }
+      size = static_cast<std::size_t>(st.st_size);
+      m = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+      (void) ::close(fd);
+      if (m == MAP_FAILED)
+        throw Int::InvalidTupleSetFile("TupleSet::TupleSet()");
+    }
+#else
+    {
+      std::ifstream is(fn.c_str(), std::ios::in | std::ios::binary);
+      if (!is)
+        throw Int::InvalidTupleSetFile("TupleSet::TupleSet()");
+      is.seekg(0, std::ios::end);
+      size = static_cast<std::size_t>(is.tellg());
+      is.seekg(0, std::ios::beg);
+      if (!is || (size < sizeof(TupleSetFileHeader)))
+        throw Int::InvalidTupleSetFile("TupleSet::TupleSet()");
+      m = heap.ralloc(size);
+      is.read(static_cast<char*>(m), static_cast<std::streamsize>(size));
+      if (!is) {
+        heap.rfree(m);
+        throw Int::InvalidTupleSetFile("TupleSet::TupleSet()");
+      }
+    }
+#endif
+    const char* b = static_cast<const char*>(m);
+    const TupleSetFileHeader& h =
+      *reinterpret_cast<const TupleSetFileHeader*>(b);
+    if ((std::memcmp(h.magic, tsf_magic, sizeof(tsf_magic)) != 0) ||
+        (h.version != tsf_version) || (h.bom != tsf_bom) ||
+        (h.word_size != sizeof(BitSetData)) ||
+        (h.arity <= 0) || (h.n_tuples < 0) ||
+        (h.n_words != BitSetData::data(static_cast<unsigned int>
+                                       (h.n_tuples))) ||
+        (TupleSetFileLayout(h).size != size)) {
+#ifdef GECODE_INT_TUPLESET_MMAP
+      (void) ::munmap(m, size);
+#else
+      heap.rfree(m);
+#endif
+      throw Int::InvalidTupleSetFile("TupleSet::TupleSet()");
+    }
+    TupleSetFileLayout l(h);
+
+    // From now on the mapped memory is owned by the data object
+    Data* d = new Data(h.arity);
+    heap.rfree(d->td);
+    d->map = m; d->map_size = size;
+    d->n_free = -1;
+    d->n_words = h.n_words;
+    d->n_tuples = h.n_tuples;
+    d->min = h.min;
+    d->max = h.max;
+    d->key = static_cast<std::size_t>(h.key);
+    d->td = reinterpret_cast<int*>(const_cast<char*>(b + l.td));
+    d->support =
+      reinterpret_cast<BitSetData*>(const_cast<char*>(b + l.s));
+    if (h.n_tuples == 0) {
+      d->td = nullptr;
+      d->support = nullptr;
+    }
+
+    // Rebuild range information pointing into the supports
+    const unsigned int* n = reinterpret_cast<const unsigned int*>(b + l.n);
+    const int* r = reinterpret_cast<const int*>(b + l.r);
+    d->range = heap.alloc<Range>(h.n_ranges);
+    unsigned int n_ranges = 0U;
+    unsigned int n_vals = 0U;
+    BitSetData* cs = d->support;
+    for (int a=0; a<h.arity; a++) {
+      d->vd[a].n = n[a];
+      d->vd[a].r = d->range + n_ranges;
+      if (n_ranges + n[a] > h.n_ranges)
+        goto invalid;
+      for (unsigned int i=0U; i<n[a]; i++) {
+        Range& cr = d->vd[a].r[i];
+        cr.min = r[2U*(n_ranges+i)];
+        cr.max = r[2U*(n_ranges+i)+1U];
+        if ((cr.min > cr.max) || (cr.min < h.min) || (cr.max > h.max) ||
+            ((i > 0U) && (d->vd[a].r[i-1U].max+1 >= cr.min)) ||
+            (n_vals + cr.width() > h.n_vals))
+          goto invalid;
+        cr.s = cs;
+        cs += h.n_words * cr.width();
+        n_vals += cr.width();
+      }
+      n_ranges += n[a];
+    }
+    if ((n_ranges != h.n_ranges) || (n_vals != h.n_vals))
+      goto invalid;
+    object(d);
+    return;
+  invalid:
+    delete d;
+    throw Int::InvalidTupleSetFile("TupleSet::TupleSet()");
+  }
+
+  std::size_t
+  TupleSet::bytes(void) const {
+    if (!*this)
+      return 0U;
+    const Data& d = raw();
+    std::size_t s = sizeof(Data) + d.arity * sizeof(ValueData);
+    if (!d.finalized())
+      return s + sizeof(int) * d.arity * (d.n_tuples + d.n_free);
+    s += sizeof(int) * d.arity * d.n_tuples;
+    if (d.n_tuples > 0)
+      for (int a=0; a<d.arity; a++) {
+        s += d.vd[a].n * sizeof(Range);
+        for (unsigned int i=0U; i<d.vd[a].n; i++)
+          s += d.n_words * d.vd[a].r[i].width() * sizeof(BitSetData);
+      }
+    return s;
+  }
+
   void
   TupleSet::_add(const IntArgs& t) {
     if (!*this)
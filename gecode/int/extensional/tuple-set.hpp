@@ -64,7 +64,7 @@ namespace Gecode {
       min(Int::Limits::max), max(Int::Limits::min), key(0),
       td(heap.alloc<int>(n_initial_free * a)),
       vd(heap.alloc<ValueData>(a)),
-      range(nullptr), support(nullptr) {
+      range(nullptr), support(nullptr), map(nullptr), map_size(0) {
   }
   
   forceinline bool
@@ -229,6 +229,15 @@ namespace Gecode {
   }
 
 
+  /*
+   * Interning statistics
+   *
+   */
+  forceinline
+  InternStatistics::InternStatistics(void)
+    : tuplesets(0UL), dfas(0UL), hits(0UL), bytes(0U) {}
+
+
   template<class Char, class Traits>
   std::basic_ostream<Char,Traits>&
   operator <<(std::basic_ostream<Char,Traits>& os, const TupleSet& ts) {
@@ -233,6 +233,33 @@ namespace Gecode { namespace Int {
     /// Test whether \a n is contained in domain (full domain)
     GECODE_INT_EXPORT bool in_full(int n) const;
 
+    /**
+     * \name Word-level domain update for small domains
+     *
+     * Domains with a width of at most \a bits_width values are updated
+     * by iterators by first computing the new domain as a single word
+     * (where bit \f$i\f$ represents the value \f$\min(x)+i\f$) and then
+     * rebuilding the range list, if needed.
+     */
+    //@{
+    /// Type for a domain represented as a single word
+    typedef unsigned long long int Bits;
+    /// Maximal width of domains for word-level update
+    static const unsigned int bits_width = 64U;
+    /// Return word with the \a n least significant bits set (\f$0<n\leq 64\f$)
+    static Bits ones(unsigned int n);
+    /// Return domain as word
+    GECODE_INT_EXPORT Bits bits(void) const;
+    /// Return word for the ranges of \a i within the domain bounds
+    template<class I>
+    Bits bits_r(I& i) const;
+    /// Return word for the values of \a i within the domain bounds
+    template<class I>
+    Bits bits_v(I& i) const;
+    /// Restrict domain to the values in \a b
+    GECODE_INT_EXPORT ModEvent narrow_bits(Space& home, Bits b);
+    //@}
+
   public:
     /// \name Domain tests
     //@{
@@ -78,6 +78,103 @@ namespace Gecode { namespace Int {
     }
   }
 
+  /*
+   * Word-level domain update
+   *
+   */
+
+  namespace {
+    /// Return position of least significant bit set in \a b
+    forceinline unsigned int
+    lsb(unsigned long long int b) {
+      assert(b != 0U);
+#if defined(GECODE_HAS_BUILTIN_FFSLL)
+      return static_cast<unsigned int>(__builtin_ffsll(b) - 1);
+#else
+      unsigned int i = 0U;
+      while (!(b & 1U)) {
+        b >>= 1; i++;
+      }
+      return i;
+#endif
+    }
+  }
+
+  IntVarImp::Bits
+  IntVarImp::bits(void) const {
+    assert(width() <= bits_width);
+    if (range())
+      return ones(width());
+    Bits b = 0U;
+    const RangeList* p = NULL;
+    const RangeList* c = fst();
+    do {
+      b |= ones(c->width()) << (c->min()-dom.min());
+      const RangeList* n=c->next(p); p=c; c=n;
+    } while (c != NULL);
+    return b;
+  }
+
+  ModEvent
+  IntVarImp::narrow_bits(Space& home, Bits b) {
+    Bits d = bits();
+    b &= d;
+    if (b == d)
+      return ME_INT_NONE;
+    // Free the current range list, a new one is created if needed
+    if (!range()) {
+      fst()->dispose(home,NULL,lst());
+      fst(NULL); holes = 0;
+    }
+    if (b == 0U)
+      return fail(home);
+    int o_min = dom.min();
+    int o_max = dom.max();
+    int n_min = o_min + static_cast<int>(lsb(b));
+    b >>= (n_min - o_min);
+    if ((b & (b+1U)) == 0U) {
+      // Domain is a range
+      unsigned int w = (~b == 0U) ? bits_width : lsb(~b);
+      dom.min(n_min); dom.max(n_min + static_cast<int>(w) - 1);
+    } else {
+      // Create range list from runs of set bits
+      RangeList* f = NULL;
+      RangeList* l = NULL;
+      unsigned int n = 0U;
+      int m = n_min;
+      while (true) {
+        assert(b & 1U);
+        unsigned int w = (~b == 0U) ? bits_width : lsb(~b);
+        RangeList* r = new (home) RangeList(m,m+static_cast<int>(w)-1);
+        if (l == NULL) {
+          r->prevnext(NULL,NULL); f = r;
+        } else {
+          r->prevnext(l,NULL); l->next(NULL,r);
+        }
+        l = r; n += w;
+        if (w == bits_width)
+          break;
+        b >>= w;
+        if (b == 0U)
+          break;
+        unsigned int z = lsb(b);
+        b >>= z;
+        m += static_cast<int>(w + z);
+      }
+      fst(f); lst(l);
+      dom.min(f->min()); dom.max(l->max());
+      holes = width() - n;
+    }
+    ModEvent me;
+    if ((dom.min() != o_min) || (dom.max() != o_max))
+      me = assigned() ? ME_INT_VAL : ME_INT_BND;
+    else
+      me = ME_INT_DOM;
+    IntDelta dl;
+    return notify(home,me,dl);
+  }
+
+
   /*
    * "Standard" tell operations
    *
@@ -296,6 +296,48 @@ namespace Gecode { namespace Int {
   }
 
 
+  /*
+   * Word-level domain update
+   *
+   */
+
+  forceinline IntVarImp::Bits
+  IntVarImp::ones(unsigned int n) {
+    assert((n > 0U) && (n <= bits_width));
+    return ~static_cast<Bits>(0U) >> (bits_width - n);
+  }
+
+  template<class I>
+  forceinline IntVarImp::Bits
+  IntVarImp::bits_r(I& i) const {
+    assert(width() <= bits_width);
+    Bits b = 0U;
+    while (i() && (i.max() < dom.min()))
+      ++i;
+    while (i() && (i.min() <= dom.max())) {
+      int l = std::max(i.min(),dom.min());
+      int u = std::min(i.max(),dom.max());
+      b |= ones(static_cast<unsigned int>(u-l+1)) << (l-dom.min());
+      ++i;
+    }
+    return b;
+  }
+
+  template<class I>
+  forceinline IntVarImp::Bits
+  IntVarImp::bits_v(I& i) const {
+    assert(width() <= bits_width);
+    Bits b = 0U;
+    while (i() && (i.val() < dom.min()))
+      ++i;
+    while (i() && (i.val() <= dom.max())) {
+      b |= static_cast<Bits>(1U) << (i.val()-dom.min());
+      ++i;
+    }
+    return b;
+  }
+
+
   /*
    * Accessing rangelists for iteration
    *
@@ -527,6 +569,11 @@ namespace Gecode { namespace Int {
       goto notify;
     }
 
+    if (width() <= bits_width) {
+      Bits b = ones(static_cast<unsigned int>(max0-min0+1)) << (min0-dom.min());
+      return narrow_bits(home, b | bits_r(ri));
+    }
+
     if (depends || range()) {
       // Construct new rangelist
       RangeList*   f = new (home) RangeList(min0,max0,NULL,NULL);
@@ -668,6 +715,8 @@ namespace Gecode { namespace Int {
   template<class I>
   forceinline ModEvent
   IntVarImp::inter_r(Space& home, I& i, bool) {
+    if (width() <= bits_width)
+      return narrow_bits(home, bits_r(i));
     IntVarImpFwd j(this);
     Iter::Ranges::Inter<I,IntVarImpFwd> ij(i,j);
     return narrow_r(home,ij,true);
@@ -677,6 +726,8 @@ namespace Gecode { namespace Int {
   forceinline ModEvent
   IntVarImp::minus_r(Space& home, I& i, bool depends) {
     if (depends) {
+      if (width() <= bits_width)
+        return narrow_bits(home, ~bits_r(i));
       IntVarImpFwd j(this);
       Iter::Ranges::Diff<IntVarImpFwd,I> ij(j,i);
       return narrow_r(home,ij,true);
@@ -704,6 +755,13 @@ namespace Gecode { namespace Int {
         (!i() || (i.min() > dom.max())))
       return gq(home,i_max+1);
 
+    if (width() <= bits_width) {
+      int l = std::max(i_min,dom.min());
+      int u = std::min(i_max,dom.max());
+      Bits b = ones(static_cast<unsigned int>(u-l+1)) << (l-dom.min());
+      return narrow_bits(home, ~(b | bits_r(i)));
+    }
+
     // Set up two sentinel elements
     RangeList f, l;
     // Put all ranges between sentinels
@@ -848,6 +906,8 @@ namespace Gecode { namespace Int {
   forceinline ModEvent
   IntVarImp::minus_v(Space& home, I& i, bool depends) {
     if (depends) {
+      if (width() <= bits_width)
+        return narrow_bits(home, ~bits_v(i));
       Iter::Values::ToRanges<I> r(i);
       return minus_r(home, r, true);
     }
@@ -870,6 +930,10 @@ namespace Gecode { namespace Int {
     if (!i() || (i.val() > dom.max()))
       return nq_full(home,v);
 
+    if (width() <= bits_width)
+      return narrow_bits(home, ~((static_cast<Bits>(1U) << (v-dom.min())) |
+                                 bits_v(i)));
+
     // Set up two sentinel elements
     RangeList f, l;
     // Put all ranges between sentinels
@@ -82,6 +82,11 @@ namespace Gecode {
   NoGoods::post(Space&) const {
   }
 
+  unsigned int
+  NoGoods::archive(Archive&) const {
+    return 0U;
+  }
+
   NoGoods NoGoods::eng;
 
   /*
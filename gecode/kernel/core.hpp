@@ -1595,6 +1595,14 @@ namespace Gecode {
     /// Post no-goods
     GECODE_KERNEL_EXPORT
     virtual void post(Space& home) const;
+    /**
+     * \brief Archive no-goods into \a e for posting in other spaces
+     *
+     * Returns the depth of the archived no-goods (0 if there are none
+     * or archiving is not supported).
+     */
+    GECODE_KERNEL_EXPORT
+    virtual unsigned int archive(Archive& e) const;
     /// Return number of no-goods posted
     unsigned long int ng(void) const;
     /// %Set number of no-goods posted to \a n
@@ -1634,6 +1642,8 @@ namespace Gecode {
     const Space* l;
     /// No-goods from restart
     const NoGoods& ng;
+    /// Relaxation probability suggested by the engine
+    const double p;
     //@}
     /// \name Portfolio-based information
     //@{
@@ -1648,7 +1658,8 @@ namespace Gecode {
              unsigned long int s,
              unsigned long int f,
              const Space* l,
-             NoGoods& ng);
+             NoGoods& ng,
+             double p=0.0);
     /// Constructor for portfolio-based engine
     MetaInfo(unsigned int a);
     //@}
@@ -1666,6 +1677,8 @@ namespace Gecode {
     const Space* last(void) const;
     /// Return no-goods recorded from restart
     const NoGoods& nogoods(void) const;
+    /// Return relaxation probability suggested by the engine (0.0 if none)
+    double relax(void) const;
     //@}
     /// \name Portfolio-based information
     //@{
@@ -3071,12 +3084,14 @@ namespace Gecode {
                      unsigned long int s0,
                      unsigned long int f0,
                      const Space* l0,
-                     NoGoods& ng0)
-    : t(RESTART), r(r0), s(s0), f(f0), l(l0), ng(ng0), a(0) {}
+                     NoGoods& ng0,
+                     double p0)
+    : t(RESTART), r(r0), s(s0), f(f0), l(l0), ng(ng0), p(p0), a(0) {}
 
   forceinline
   MetaInfo::MetaInfo(unsigned int a0)
-    : t(PORTFOLIO), r(0), s(0), f(0), l(NULL), ng(NoGoods::eng), a(a0) {}
+    : t(PORTFOLIO), r(0), s(0), f(0), l(NULL), ng(NoGoods::eng), p(0.0),
+      a(a0) {}
 
   forceinline MetaInfo::Type
   MetaInfo::type(void) const {
@@ -3107,6 +3122,11 @@ namespace Gecode {
     assert(type() == RESTART);
     return ng;
   }
+  forceinline double
+  MetaInfo::relax(void) const {
+    assert(type() == RESTART);
+    return p;
+  }
   forceinline unsigned int
   MetaInfo::asset(void) const {
     assert(type() == PORTFOLIO);
@@ -3523,7 +3543,8 @@ namespace Gecode {
 
   forceinline double
   Propagator::afc(void) const {
-    return const_cast<Propagator&>(*this).gpi().afc;
+    return const_cast<Propagator&>(*this).gpi().afc
+      .load(std::memory_order_relaxed);
   }
 
 #ifdef GECODE_HAS_CBS
@@ -32,10 +32,19 @@
  */
 
 #include <cmath>
+#include <atomic>
 
 namespace Gecode { namespace Kernel {
 
-  /// Global propagator information
+  /**
+   * \brief Global propagator information
+   *
+   * The afc values and the decay factor are updated atomically
+   * without taking a lock, so that recording a failure does not
+   * serialize parallel search workers. The mutex is only needed for
+   * allocating information and for rescaling.
+   *
+   */
   class GPI {
   public:
     /// Class for storing propagator information
@@ -46,7 +55,7 @@ namespace Gecode { namespace Kernel {
       /// Group identifier
       unsigned int gid;
       /// The afc value
-      double afc;
+      std::atomic<double> afc;
       /// Initialize
       void init(unsigned int pid, unsigned int gid);
     };
@@ -70,7 +79,7 @@ namespace Gecode { namespace Kernel {
     /// The current block
     Block* b;
     /// The inverse decay factor
-    double invd;
+    std::atomic<double> invd;
     /// Next free propagator id
     unsigned int npid;
     /// Whether to unshare
@@ -103,7 +112,7 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::Info::init(unsigned int pid0, unsigned int gid0) {
-    pid=pid0; gid=gid0; afc=1.0;
+    pid=pid0; gid=gid0; afc.store(1.0,std::memory_order_relaxed);
   }
 
 
@@ -113,8 +122,12 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::Block::rescale(void) {
-    for (int i=free; i < n_info; i++)
-      info[i].afc *= Kernel::Config::rescale;
+    for (int i=free; i < n_info; i++) {
+      double o = info[i].afc.load(std::memory_order_relaxed);
+      while (!info[i].afc.compare_exchange_weak
+             (o, o * Kernel::Config::rescale, std::memory_order_relaxed))
+        ;
+    }
   }
 
 
@@ -124,21 +137,26 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::fail(Info& c) {
-    m.acquire();
-    c.afc = invd * (c.afc + 1.0);
-    if (c.afc > Kernel::Config::rescale_limit)
-      for (Block* i = b; i != NULL; i = i->next)
-        i->rescale();
-    m.release();
+    double d = invd.load(std::memory_order_relaxed);
+    double o = c.afc.load(std::memory_order_relaxed);
+    double n;
+    do {
+      n = d * (o + 1.0);
+    } while (!c.afc.compare_exchange_weak(o, n, std::memory_order_relaxed));
+    if (n > Kernel::Config::rescale_limit) {
+      m.acquire();
+      // Another thread might have rescaled in the meantime
+      if (c.afc.load(std::memory_order_relaxed) >
+          Kernel::Config::rescale_limit)
+        for (Block* i = b; i != NULL; i = i->next)
+          i->rescale();
+      m.release();
+    }
   }
 
   forceinline double
   GPI::decay(void) const {
-    double d;
-    const_cast<GPI&>(*this).m.acquire();
-    d = 1.0 / invd;
-    const_cast<GPI&>(*this).m.release();
-    return d;
+    return 1.0 / invd.load(std::memory_order_relaxed);
   }
 
   forceinline unsigned int
@@ -161,9 +179,7 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::decay(double d) {
-    m.acquire();
-    invd = 1.0 / d;
-    m.release();
+    invd.store(1.0 / d, std::memory_order_relaxed);
   }
 
   forceinline GPI::Info*
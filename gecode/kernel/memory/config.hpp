@@ -42,9 +42,19 @@ namespace Gecode { namespace Kernel {
    */
   namespace MemoryConfig {
     /**
-     * \brief How many heap chunks should be cached at most
+     * \brief How many heap chunks should be cached at most in a shared pool
+     *
+     * This is only the initial value, it can be changed at run time
+     * by Kernel::SharedMemory::shared_cache().
      */
     const unsigned int n_hc_cache = 4*4;
+    /**
+     * \brief How many heap chunks should be cached at most per thread
+     *
+     * This is only the initial value, it can be changed at run time
+     * by Kernel::SharedMemory::thread_cache().
+     */
+    const unsigned int n_hc_cache_thread = 4;
 
     /**
      * \brief Minimal size of a heap chunk requested from the OS
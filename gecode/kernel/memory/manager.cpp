@@ -33,11 +33,132 @@
 
 #include <gecode/kernel.hh>
 
+#include <atomic>
+
 namespace Gecode { namespace Kernel {
 
-  Support::Mutex& SharedMemory::m(void) {
-    static Support::Mutex _m;
-    return _m;
+  namespace {
+
+    /// Heap chunks cached by a single thread
+    class ThreadCache {
+    public:
+      /// How many heap chunks are cached
+      unsigned int n_hc;
+      /// A list of cached heap chunks
+      HeapChunk* hc;
+      /// Initialize
+      ThreadCache(void) : n_hc(0U), hc(NULL) {}
+      /// Release all cached heap chunks when the thread terminates
+      ~ThreadCache(void) {
+        while (hc != NULL) {
+          HeapChunk* t = hc;
+          hc = static_cast<HeapChunk*>(t->next);
+          Gecode::heap.rfree(t);
+        }
+      }
+    };
+
+    /// The heap chunk cache of the current thread
+    thread_local ThreadCache tc;
+
+    /// How many heap chunks are cached at most per thread
+    std::atomic<unsigned int> n_hc_thread(MemoryConfig::n_hc_cache_thread);
+    /// How many heap chunks are cached at most in a shared pool
+    std::atomic<unsigned int> n_hc_shared(MemoryConfig::n_hc_cache);
+    /// How many requests have been served by a cache
+    std::atomic<unsigned long int> n_hits(0UL);
+    /// How many requests required new memory
+    std::atomic<unsigned long int> n_misses(0UL);
+
+  }
+
+  HeapChunk*
+  SharedMemory::alloc(size_t s, size_t l) {
+    // Try the cache of the current thread first, no locking needed
+    {
+      ThreadCache& c = tc;
+      HeapChunk* p = NULL;
+      for (HeapChunk* hc = c.hc; hc != NULL;
+           p = hc, hc = static_cast<HeapChunk*>(hc->next))
+        if (hc->size >= l) {
+          if (p == NULL)
+            c.hc = static_cast<HeapChunk*>(hc->next);
+          else
+            p->next = hc->next;
+          c.n_hc--;
+          n_hits.fetch_add(1UL,std::memory_order_relaxed);
+          return hc;
+        }
+    }
+    HeapChunk* hc;
+    {
+      // To protect from exceptions from heap.ralloc()
+      Support::Lock guard(m);
+      while ((heap.hc != NULL) && (heap.hc->size < l)) {
+        heap.n_hc--;
+        HeapChunk* t = heap.hc;
+        heap.hc = static_cast<HeapChunk*>(t->next);
+        Gecode::heap.rfree(t);
+      }
+      if (heap.hc != NULL) {
+        heap.n_hc--;
+        hc = heap.hc;
+        heap.hc = static_cast<HeapChunk*>(hc->next);
+        n_hits.fetch_add(1UL,std::memory_order_relaxed);
+        return hc;
+      }
+      assert(heap.n_hc == 0);
+    }
+    hc = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
+    hc->size = s;
+    n_misses.fetch_add(1UL,std::memory_order_relaxed);
+    return hc;
+  }
+
+  void
+  SharedMemory::free(HeapChunk* hc) {
+    // Only chunks of regular size are cached per thread
+    ThreadCache& c = tc;
+    if ((hc->size <= MemoryConfig::hcsz_max) &&
+        (c.n_hc < n_hc_thread.load(std::memory_order_relaxed))) {
+      c.n_hc++;
+      hc->next = c.hc; c.hc = hc;
+      return;
+    }
+    {
+      Support::Lock guard(m);
+      if (heap.n_hc < n_hc_shared.load(std::memory_order_relaxed)) {
+        heap.n_hc++;
+        hc->next = heap.hc; heap.hc = hc;
+        return;
+      }
+    }
+    Gecode::heap.rfree(hc);
+  }
+
+  void
+  SharedMemory::thread_cache(unsigned int n) {
+    n_hc_thread.store(n,std::memory_order_relaxed);
+  }
+  unsigned int
+  SharedMemory::thread_cache(void) {
+    return n_hc_thread.load(std::memory_order_relaxed);
+  }
+  void
+  SharedMemory::shared_cache(unsigned int n) {
+    n_hc_shared.store(n,std::memory_order_relaxed);
+  }
+  unsigned int
+  SharedMemory::shared_cache(void) {
+    return n_hc_shared.load(std::memory_order_relaxed);
+  }
+  unsigned long int
+  SharedMemory::hits(void) {
+    return n_hits.load(std::memory_order_relaxed);
+  }
+  unsigned long int
+  SharedMemory::misses(void) {
+    return n_misses.load(std::memory_order_relaxed);
   }
 
   void
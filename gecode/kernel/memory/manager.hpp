@@ -56,7 +56,16 @@ namespace Gecode { namespace Kernel {
     double area[1];
   };
 
-  /// Shared object for several memory areas
+  /**
+   * \brief Shared object for several memory areas
+   *
+   * Heap chunks are cached at two levels: each thread has a small
+   * cache of heap chunks that can be accessed without synchronization,
+   * and chunks that do not fit into that cache are kept in a pool
+   * shared by a space and all its clones. The limits for both levels
+   * can be changed at run time.
+   *
+   */
   class SharedMemory {
   private:
     /// The components for shared heap memory
@@ -67,7 +76,7 @@ namespace Gecode { namespace Kernel {
       HeapChunk* hc;
     } heap;
     /// A mutex for access
-    GECODE_KERNEL_EXPORT static Support::Mutex& m(void);
+    Support::Mutex m;
   public:
     /// Initialize
     SharedMemory(void);
@@ -76,10 +85,33 @@ namespace Gecode { namespace Kernel {
     /// \name Heap management
     //@
     /// Return heap chunk, preferable of size \a s, but at least of size \a l
+    GECODE_KERNEL_EXPORT
     HeapChunk* alloc(size_t s, size_t l);
     /// Free heap chunk (or cache for later)
+    GECODE_KERNEL_EXPORT
     void free(HeapChunk* hc);
     //@}
+    /// \name Cache configuration and statistics
+    //@{
+    /// Set how many heap chunks are cached at most per thread to \a n
+    GECODE_KERNEL_EXPORT
+    static void thread_cache(unsigned int n);
+    /// Return how many heap chunks are cached at most per thread
+    GECODE_KERNEL_EXPORT
+    static unsigned int thread_cache(void);
+    /// Set how many heap chunks are cached at most in a shared pool to \a n
+    GECODE_KERNEL_EXPORT
+    static void shared_cache(unsigned int n);
+    /// Return how many heap chunks are cached at most in a shared pool
+    GECODE_KERNEL_EXPORT
+    static unsigned int shared_cache(void);
+    /// Return how many requests for heap chunks have been served by a cache
+    GECODE_KERNEL_EXPORT
+    static unsigned long int hits(void);
+    /// Return how many requests for heap chunks required new memory
+    GECODE_KERNEL_EXPORT
+    static unsigned long int misses(void);
+    //@}
   };
 
 
@@ -194,38 +226,6 @@ namespace Gecode { namespace Kernel {
     }
   }
 
-  forceinline HeapChunk*
-  SharedMemory::alloc(size_t s, size_t l) {
-    // To protect from exceptions from heap.ralloc()
-    Support::Lock guard(m());
-    while ((heap.hc != NULL) && (heap.hc->size < l)) {
-      heap.n_hc--;
-      HeapChunk* hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
-      Gecode::heap.rfree(hc);
-    }
-    HeapChunk* hc;
-    if (heap.hc == NULL) {
-      assert(heap.n_hc == 0);
-      hc = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
-      hc->size = s;
-    } else {
-      heap.n_hc--;
-      hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
-    }
-    return hc;
-  }
-  forceinline void
-  SharedMemory::free(HeapChunk* hc) {
-    Support::Lock guard(m());
-    if (heap.n_hc == MemoryConfig::n_hc_cache) {
-      Gecode::heap.rfree(hc);
-    } else {
-      heap.n_hc++;
-      hc->next = heap.hc; heap.hc = hc;
-    }
-  }
 
 
 }}
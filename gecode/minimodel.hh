@@ -2361,6 +2361,12 @@ namespace Gecode {
    * Provides for minimizing or maximizing the cost value as defined by
    * a cost-member function of a space.
    *
+   * Besides constraining a space by a best solution, the classes give
+   * access to the objective of a solution as a scalar value (or as a
+   * vector of values for lexicographic optimization) and can constrain
+   * a space by such a bound directly. This avoids passing entire spaces
+   * when only the bound is known.
+   *
    * \ingroup TaskModelMiniModel
    */
 
@@ -2379,6 +2385,11 @@ namespace Gecode {
     virtual void constrain(const Space& best);
     /// Return variable with current cost
     virtual IntVar cost(void) const = 0;
+    /// Return cost value of a solution (cost must be assigned)
+    int objective(void) const;
+    /// Constrain cost to be lower than \a b
+    GECODE_MINIMODEL_EXPORT
+    void improve(int b);
   };
 
   /**
@@ -2396,6 +2407,11 @@ namespace Gecode {
     virtual void constrain(const Space& best);
     /// Return variable with current cost
     virtual IntVar cost(void) const = 0;
+    /// Return cost value of a solution (cost must be assigned)
+    int objective(void) const;
+    /// Constrain cost to be higher than \a b
+    GECODE_MINIMODEL_EXPORT
+    void improve(int b);
   };
 
   /**
@@ -2413,6 +2429,11 @@ namespace Gecode {
     virtual void constrain(const Space& best);
     /// Return variables with current costs
     virtual IntVarArgs cost(void) const = 0;
+    /// Return cost values of a solution (all costs must be assigned)
+    IntArgs objective(void) const;
+    /// Constrain costs to be lexicographically lower than \a b
+    GECODE_MINIMODEL_EXPORT
+    void improve(const IntArgs& b);
   };
 
   /**
@@ -2430,6 +2451,11 @@ namespace Gecode {
     virtual void constrain(const Space& best);
     /// Return variables with current costs
     virtual IntVarArgs cost(void) const = 0;
+    /// Return cost values of a solution (all costs must be assigned)
+    IntArgs objective(void) const;
+    /// Constrain costs to be lexicographically higher than \a b
+    GECODE_MINIMODEL_EXPORT
+    void improve(const IntArgs& b);
   };
 
 #ifdef GECODE_HAS_FLOAT_VARS
@@ -2457,6 +2483,11 @@ namespace Gecode {
     virtual void constrain(const Space& best);
     /// Return variable with current cost
     virtual FloatVar cost(void) const = 0;
+    /// Return cost value of a solution (cost must be assigned)
+    FloatVal objective(void) const;
+    /// Constrain cost to be lower than \a b - \a step
+    GECODE_MINIMODEL_EXPORT
+    void improve(const FloatVal& b);
   };
 
   /**
@@ -2482,6 +2513,11 @@ namespace Gecode {
     virtual void constrain(const Space& best);
     /// Return variable with current cost
     virtual FloatVar cost(void) const = 0;
+    /// Return cost value of a solution (cost must be assigned)
+    FloatVal objective(void) const;
+    /// Constrain cost to be higher than \a b + \a step
+    GECODE_MINIMODEL_EXPORT
+    void improve(const FloatVal& b);
   };
 
 #endif
@@ -41,7 +41,12 @@ namespace Gecode {
       dynamic_cast<const IntMinimizeSpace*>(&_best);
     if (best == nullptr)
       throw DynamicCastFailed("IntMinimizeSpace::constrain");
-    rel(*this, cost(), IRT_LE, best->cost().val());
+    improve(best->objective());
+  }
+
+  void
+  IntMinimizeSpace::improve(int b) {
+    rel(*this, cost(), IRT_LE, b);
   }
 
 
@@ -51,7 +56,12 @@ namespace Gecode {
       dynamic_cast<const IntMaximizeSpace*>(&_best);
     if (best == nullptr)
       throw DynamicCastFailed("IntMaximizeSpace::constrain");
-    rel(*this, cost(), IRT_GR, best->cost().val());
+    improve(best->objective());
+  }
+
+  void
+  IntMaximizeSpace::improve(int b) {
+    rel(*this, cost(), IRT_GR, b);
   }
 
 
@@ -61,11 +71,13 @@ namespace Gecode {
       dynamic_cast<const IntLexMinimizeSpace*>(&_best);
     if (best == nullptr)
       throw DynamicCastFailed("IntLexMinimizeSpace::constrain");
-    IntVarArgs cx(cost()), bx(best->cost());
-    IntArgs bn(bx.size());
-    for (int i=bn.size(); i--; )
-      bn[i] = bx[i].val();
-    rel(*this, cx, IRT_LE, bn);
+    improve(best->objective());
+  }
+
+  void
+  IntLexMinimizeSpace::improve(const IntArgs& b) {
+    IntVarArgs cx(cost());
+    rel(*this, cx, IRT_LE, b);
   }
 
   void
@@ -74,11 +86,13 @@ namespace Gecode {
       dynamic_cast<const IntLexMaximizeSpace*>(&_best);
     if (best == nullptr)
       throw DynamicCastFailed("IntLexMaximizeSpace::constrain");
-    IntVarArgs cx(cost()), bx(best->cost());
-    IntArgs bn(bx.size());
-    for (int i=bn.size(); i--; )
-      bn[i] = bx[i].val();
-    rel(*this, cx, IRT_GR, bn);
+    improve(best->objective());
+  }
+
+  void
+  IntLexMaximizeSpace::improve(const IntArgs& b) {
+    IntVarArgs cx(cost());
+    rel(*this, cx, IRT_GR, b);
   }
 
 #ifdef GECODE_HAS_FLOAT_VARS
@@ -89,7 +103,12 @@ namespace Gecode {
       dynamic_cast<const FloatMinimizeSpace*>(&_best);
     if (best == nullptr)
       throw DynamicCastFailed("FloatMinimizeSpace::constrain");
-    rel(*this, cost(), FRT_LE, best->cost().val()-step);
+    improve(best->objective());
+  }
+
+  void
+  FloatMinimizeSpace::improve(const FloatVal& b) {
+    rel(*this, cost(), FRT_LE, b-step);
   }
 
 
@@ -99,7 +118,12 @@ namespace Gecode {
       dynamic_cast<const FloatMaximizeSpace*>(&_best);
     if (best == nullptr)
       throw DynamicCastFailed("FloatMaximizeSpace::constrain");
-    rel(*this, cost(), FRT_GR, best->cost().val()+step);
+    improve(best->objective());
+  }
+
+  void
+  FloatMaximizeSpace::improve(const FloatVal& b) {
+    rel(*this, cost(), FRT_GR, b+step);
   }
 
 #endif
@@ -40,6 +40,11 @@ namespace Gecode {
   IntMinimizeSpace::IntMinimizeSpace(IntMinimizeSpace& s)
     : Space(s) {}
 
+  forceinline int
+  IntMinimizeSpace::objective(void) const {
+    return cost().val();
+  }
+
 
   forceinline
   IntMaximizeSpace::IntMaximizeSpace(void) {}
@@ -48,6 +53,11 @@ namespace Gecode {
   IntMaximizeSpace::IntMaximizeSpace(IntMaximizeSpace& s)
     : Space(s) {}
 
+  forceinline int
+  IntMaximizeSpace::objective(void) const {
+    return cost().val();
+  }
+
 
   forceinline
   IntLexMinimizeSpace::IntLexMinimizeSpace(void) {}
@@ -56,6 +66,15 @@ namespace Gecode {
   IntLexMinimizeSpace::IntLexMinimizeSpace(IntLexMinimizeSpace& s)
     : Space(s) {}
 
+  forceinline IntArgs
+  IntLexMinimizeSpace::objective(void) const {
+    IntVarArgs x(cost());
+    IntArgs b(x.size());
+    for (int i=b.size(); i--; )
+      b[i] = x[i].val();
+    return b;
+  }
+
 
   forceinline
   IntLexMaximizeSpace::IntLexMaximizeSpace(void) {}
@@ -64,6 +83,15 @@ namespace Gecode {
   IntLexMaximizeSpace::IntLexMaximizeSpace(IntLexMaximizeSpace& s)
     : Space(s) {}
 
+  forceinline IntArgs
+  IntLexMaximizeSpace::objective(void) const {
+    IntVarArgs x(cost());
+    IntArgs b(x.size());
+    for (int i=b.size(); i--; )
+      b[i] = x[i].val();
+    return b;
+  }
+
 
 #ifdef GECODE_HAS_FLOAT_VARS
 
@@ -75,6 +103,11 @@ namespace Gecode {
   FloatMinimizeSpace::FloatMinimizeSpace(FloatMinimizeSpace& s)
     : Space(s), step(s.step) {}
 
+  forceinline FloatVal
+  FloatMinimizeSpace::objective(void) const {
+    return cost().val();
+  }
+
 
   forceinline
   FloatMaximizeSpace::FloatMaximizeSpace(FloatNum s)
@@ -84,6 +117,11 @@ namespace Gecode {
   FloatMaximizeSpace::FloatMaximizeSpace(FloatMaximizeSpace& s)
     : Space(s), step(s.step) {}
 
+  forceinline FloatVal
+  FloatMaximizeSpace::objective(void) const {
+    return cost().val();
+  }
+
 #endif
 
 }
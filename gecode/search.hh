@@ -75,6 +75,14 @@
 #include <gecode/support/auto-link.hpp>
 #endif
 
+/*
+ * Distributed search requires sockets
+ *
+ */
+#if defined(__unix__) || defined(__APPLE__)
+#define GECODE_SEARCH_HAS_DIST
+#endif
+
 
 namespace Gecode { namespace Search {
 
@@ -98,6 +106,21 @@ namespace Gecode { namespace Search {
   }
 
 
+  /**
+   * \brief Victim selection for work stealing in parallel engines
+   *
+   * Defines in which order an idle worker of a parallel search engine
+   * tries the other workers when it attempts to steal work.
+   *
+   * \ingroup TaskModelSearch
+   */
+  enum StealMode {
+    STEAL_LINEAR,     ///< Try workers in order, starting from the first
+    STEAL_ROUNDROBIN, ///< Try workers in order, starting after the thief
+    STEAL_RANDOM,     ///< Try workers in random order
+    STEAL_RICHEST     ///< Try workers with most stealable work first
+  };
+
   /**
    * \brief %Search configuration
    *
@@ -116,22 +139,37 @@ namespace Gecode { namespace Search {
 
     /// Minimal number of open nodes for stealing
     const unsigned int steal_limit = 3;
+    /// Default victim selection for stealing
+    const StealMode steal = STEAL_ROUNDROBIN;
+    /// How often a thief waits for an answer before withdrawing a steal request
+    const unsigned int steal_wait = 1024;
     /// Initial delay in milliseconds for all but first worker thread
     const unsigned int initial_delay = 5;
+    /// Number of subproblems for parallel search (0 = no decomposition)
+    const unsigned int subproblems = 0;
 
     /// Default discrepancy limit for LDS
     const unsigned int d_l = 5;
 
     /// Base for geometric restart sequence
     const double base = 1.5;
+    /// Initial relaxation probability for restart-based search (0.0 = none)
+    const double relax = 0.0;
     /// Size of a slice in a portfolio and scale factor for restarts(in number of failures)
     const unsigned int slice = 250;
 
     /// Depth limit for no-good generation during search
     const unsigned int nogoods_limit = 128;
+    /// Number of no-good paths shared by parallel restart-based search
+    const unsigned int nogoods_share = 256;
 
     /// Default port for CPProfiler
     const unsigned int cpprofiler_port = 6565U;
+
+    /// Number of nodes a distributed worker explores between checking for messages
+    const unsigned int dist_poll = 16;
+    /// Delay in milliseconds before the coordinator asks a worker without work again
+    const unsigned int dist_retry = 10;
   }
 
 }}
@@ -156,6 +194,20 @@ namespace Gecode { namespace Search {
     unsigned long int restart;
     /// Number of no-goods posted
     unsigned long int nogood;
+    /// Number of no-good paths exported to the shared store
+    unsigned long int nogood_export;
+    /// Number of no-good paths imported from the shared store
+    unsigned long int nogood_import;
+    /// Number of no-goods posted from imported paths
+    unsigned long int nogood_shared;
+    /// Number of attempts to steal work from other workers
+    unsigned long int steal_attempt;
+    /// Number of successful attempts to steal work
+    unsigned long int steal_success;
+    /// Number of subproblems taken from the decomposition of the root
+    unsigned long int subproblem;
+    /// Maximal number of nodes explored for a single subproblem
+    unsigned long int subproblem_node;
     /// Initialize
     Statistics(void);
     /// Reset
@@ -479,6 +531,14 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const = 0;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void) = 0;
+    /**
+     * \brief Return copy for the \a i-th of several engines running in parallel
+     *
+     * The copy continues the sequence from the current value. Random
+     * sequences use a different seed for each \a i. The default
+     * implementation returns NULL, meaning that copying is not supported.
+     */
+    virtual Cutoff* copy(unsigned int i) const;
     /// Destructor
     virtual ~Cutoff(void);
     //@}
@@ -533,6 +593,8 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void);
+    /// Return copy for the \a i-th of several engines running in parallel
+    virtual Cutoff* copy(unsigned int i) const;
   };
 
   /**
@@ -552,6 +614,8 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void);
+    /// Return copy for the \a i-th of several engines running in parallel
+    virtual Cutoff* copy(unsigned int i) const;
   };
 
   /**
@@ -579,6 +643,8 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void);
+    /// Return copy for the \a i-th of several engines running in parallel
+    virtual Cutoff* copy(unsigned int i) const;
   };
 
   /**
@@ -600,6 +666,8 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void);
+    /// Return copy for the \a i-th of several engines running in parallel
+    virtual Cutoff* copy(unsigned int i) const;
   };
 
   /**
@@ -627,6 +695,8 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void);
+    /// Return copy for the \a i-th of several engines running in parallel
+    virtual Cutoff* copy(unsigned int i) const;
   };
 
   /**
@@ -648,6 +718,8 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void);
+    /// Return copy for the \a i-th of several engines running in parallel
+    virtual Cutoff* copy(unsigned int i) const;
     /// Destructor
     virtual ~CutoffAppend(void);
   };
@@ -669,6 +741,8 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void);
+    /// Return copy for the \a i-th of several engines running in parallel
+    virtual Cutoff* copy(unsigned int i) const;
     /// Destructor
     virtual ~CutoffMerge(void);
   };
@@ -694,6 +768,8 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void);
+    /// Return copy for the \a i-th of several engines running in parallel
+    virtual Cutoff* copy(unsigned int i) const;
     /// Destructor
     virtual ~CutoffRepeat(void);
   };
@@ -761,6 +837,40 @@ namespace Gecode { namespace Search {
       unsigned int slice;
       /// Depth limit for extraction of no-goods
       unsigned int nogoods_limit;
+      /**
+       * \brief Number of no-good paths shared between workers
+       *
+       * If non-zero and no-goods are extracted (see \a nogoods_limit),
+       * the workers of parallel restart-based search share a store of
+       * at most that many paths. At each restart, a worker adds its own
+       * path to the store and, if the model posts no-goods, also posts
+       * the paths added by other workers since its last restart.
+       */
+      unsigned int nogoods_share;
+      /// Victim selection for work stealing (parallel engines)
+      StealMode steal;
+      /**
+       * \brief Number of subproblems the root is decomposed into
+       *
+       * If non-zero, parallel engines first decompose the root
+       * breadth-first into at least that many subproblems (unless the
+       * search tree is smaller) before the workers start. Workers take
+       * subproblems from a shared queue and only steal work from other
+       * workers after all subproblems have been taken. Subproblems
+       * that fail during decomposition are rejected. Decomposition is
+       * not performed if search is traced.
+       */
+      unsigned int subproblems;
+      /**
+       * \brief Initial relaxation probability for restart-based search
+       *
+       * If non-zero, restart-based engines adapt the relaxation
+       * probability to the outcome of each neighbourhood and pass it
+       * to the model through MetaInfo::relax: it is increased if a
+       * neighbourhood is exhausted without a solution and decreased if
+       * the cutoff is reached without a solution.
+       */
+      double relax;
       /// Stop object for stopping search
       Stop* stop;
       /// Cutoff for restart-based search
@@ -952,6 +1062,49 @@ namespace Gecode { namespace Search {
 
 #include <gecode/search/base.hpp>
 
+namespace Gecode { namespace Search {
+
+  /**
+   * \brief Path of archived choices from a root space
+   *
+   * A choice path identifies a node in the search tree of a root
+   * space: for each choice on the way from the root it stores the
+   * archived choice (see Choice::archive) together with the alternative
+   * taken. As the choices are archived, a path can be sent to another
+   * process and replayed there in a space created from the same model.
+   *
+   * \ingroup TaskModelSearch
+   */
+  class GECODE_SEARCH_EXPORT ChoicePath {
+  protected:
+    /// Number of choices on the path
+    unsigned int n;
+    /// For each choice: alternative, size of archive, and archive
+    Archive a;
+  public:
+    /// Initialize as path to the root
+    ChoicePath(void);
+    /// Initialize from archive \a e as written by archive()
+    ChoicePath(Archive& e);
+    /// Add choice \a c with alternative \a alt to the end of the path
+    void push(const Choice& c, unsigned int alt);
+    /// Return number of choices on the path
+    unsigned int size(void) const;
+    /// Archive path into \a e
+    void archive(Archive& e) const;
+    /**
+     * \brief Return clone of \a root after committing to all choices
+     *
+     * The space \a root must be stable and must not be failed. The
+     * returned space has not been propagated yet.
+     */
+    Space* replay(const Space& root) const;
+  };
+
+}}
+
+#include <gecode/search/choice-path.hpp>
+
 namespace Gecode { namespace Search {
 
   /// Build an engine of type \a E for a script \a T
@@ -1146,6 +1299,14 @@ namespace Gecode {
    * space. For more details, consult "Modeling and Programming
    * with Gecode".
    *
+   * If \a E is a best solution engine, more than one thread is
+   * requested, and the cutoff sequence can be copied (see
+   * Search::Cutoff::copy), each thread runs its own sequential
+   * restart-based search with its own copy of the cutoff sequence,
+   * where the copy for the \a i-th thread starts \a i steps ahead.
+   * Better solutions found by one thread immediately constrain all
+   * other threads. Otherwise, all threads restart together.
+   *
    * \ingroup TaskModelSearch
    */
   template<class T, template<class> class E = DFS>
@@ -1284,6 +1445,128 @@ namespace Gecode {
 
 #include <gecode/search/pbs.hpp>
 
+#ifdef GECODE_SEARCH_HAS_DIST
+
+namespace Gecode { namespace Search {
+
+  /**
+   * \brief Distributed search
+   *
+   * A distributed search runs several worker processes (possibly on
+   * different machines) that do not share memory. Each worker creates
+   * the same root space and connects to a coordinator. Subtrees are
+   * exchanged as choice paths (see ChoicePath) relative to the root:
+   * the coordinator hands out subtrees to idle workers by asking busy
+   * workers to donate an open alternative close to their root. For
+   * best solution search, the coordinator broadcasts each solution
+   * as a path to all workers, which then constrain their remaining
+   * search accordingly.
+   *
+   * Addresses are either \c unix:<path> for a Unix domain socket or
+   * <host>:<port> (or just <port> for \c localhost) for TCP.
+   *
+   * \ingroup TaskModelSearch
+   */
+  namespace Dist {
+
+    /**
+     * \brief Coordinator for distributed search
+     *
+     * The coordinator does not need the model: it only passes choice
+     * paths between the workers. The search is finished when the
+     * expected number of workers has connected, all of them have
+     * requested work, and no work is left.
+     *
+     * \ingroup TaskModelSearch
+     */
+    class GECODE_SEARCH_EXPORT Coordinator {
+    protected:
+      /// Listening socket
+      int l;
+      /// Number of workers expected to connect
+      unsigned int n;
+      /// Number of workers that have connected
+      unsigned long int _workers;
+      /// Number of subtrees handed out to workers
+      unsigned long int _subtrees;
+      /// Number of requests to donate a subtree
+      unsigned long int _steals;
+      /// Number of solutions reported by workers
+      unsigned long int _solutions;
+      /// Whether no worker disconnected while exploring
+      bool _complete;
+    public:
+      /// Initialize for \a n workers and listen on address \a a
+      Coordinator(const std::string& a, unsigned int n);
+      /// Coordinate search until all work is done
+      void run(void);
+      /// Return number of workers that have connected
+      unsigned long int workers(void) const;
+      /// Return number of subtrees handed out to workers
+      unsigned long int subtrees(void) const;
+      /// Return number of requests to donate a subtree
+      unsigned long int steals(void) const;
+      /// Return number of solutions reported by workers
+      unsigned long int solutions(void) const;
+      /// Return whether all subtrees have been explored completely
+      bool complete(void) const;
+      /// Destructor
+      ~Coordinator(void);
+    };
+
+    /// Create distributed depth-first engine connected to address \a a
+    GECODE_SEARCH_EXPORT Engine*
+    dfsengine(Space* s, const std::string& a, const Options& o);
+
+    /// Create distributed branch-and-bound engine connected to address \a a
+    GECODE_SEARCH_EXPORT Engine*
+    babengine(Space* s, const std::string& a, const Options& o);
+
+    /**
+     * \brief Worker for distributed depth-first search
+     *
+     * Returns the solutions found by this worker.
+     *
+     * \ingroup TaskModelSearch
+     */
+    template<class T>
+    class DFS : public Search::Base<T> {
+    public:
+      /// Initialize for space \a s, coordinator address \a a, and options \a o
+      DFS(T* s, const std::string& a,
+          const Search::Options& o=Search::Options::def);
+      /// Whether engine does best solution search
+      static const bool best = false;
+    };
+
+    /**
+     * \brief Worker for distributed depth-first branch-and-bound search
+     *
+     * Returns the solutions found by this worker and the better
+     * solutions found by other workers, each better than the solution
+     * returned before. The last solution returned is the best solution
+     * of the entire search.
+     *
+     * \ingroup TaskModelSearch
+     */
+    template<class T>
+    class BAB : public Search::Base<T> {
+    public:
+      /// Initialize for space \a s, coordinator address \a a, and options \a o
+      BAB(T* s, const std::string& a,
+          const Search::Options& o=Search::Options::def);
+      /// Whether engine does best solution search
+      static const bool best = true;
+    };
+
+  }
+
+}}
+
+#include <gecode/search/dist.hpp>
+
+#endif
+
 #endif
 
 // STATISTICS: search-other
@@ -0,0 +1,81 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search.hh>
+
+namespace Gecode { namespace Search {
+
+  ChoicePath::ChoicePath(Archive& e) {
+    e >> n;
+    unsigned int m; e >> m;
+    for (unsigned int i=0U; i<m; i++)
+      a << e.get();
+  }
+
+  void
+  ChoicePath::push(const Choice& c, unsigned int alt) {
+    Archive e;
+    c.archive(e);
+    a << alt << e.size();
+    for (int i=0; i<e.size(); i++)
+      a << e[i];
+    n++;
+  }
+
+  void
+  ChoicePath::archive(Archive& e) const {
+    e << n << a.size();
+    for (int i=0; i<a.size(); i++)
+      e << a[i];
+  }
+
+  Space*
+  ChoicePath::replay(const Space& root) const {
+    Space* s = root.clone();
+    int k = 0;
+    for (unsigned int i=0U; i<n; i++) {
+      unsigned int alt = a[k++];
+      int m = static_cast<int>(a[k++]);
+      Archive e;
+      for (int j=0; j<m; j++)
+        e << a[k++];
+      const Choice* c = s->choice(e);
+      s->commit(*c,alt);
+      delete c;
+    }
+    return s;
+  }
+
+}}
+
+// STATISTICS: search-other
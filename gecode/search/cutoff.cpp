@@ -40,6 +40,12 @@
 
 namespace Gecode { namespace Search {
 
+  Cutoff*
+  Cutoff::copy(unsigned int) const {
+    return NULL;
+  }
+
+
   unsigned long int
   CutoffConstant::operator ()(void) const {
     return c;
@@ -48,6 +54,10 @@ namespace Gecode { namespace Search {
   CutoffConstant::operator ++(void) {
     return c;
   }
+  Cutoff*
+  CutoffConstant::copy(unsigned int) const {
+    return new CutoffConstant(*this);
+  }
 
 
   unsigned long int
@@ -59,6 +69,10 @@ namespace Gecode { namespace Search {
     n += scale;
     return n;
   }
+  Cutoff*
+  CutoffLinear::copy(unsigned int) const {
+    return new CutoffLinear(*this);
+  }
 
 
   unsigned long int
@@ -74,6 +88,10 @@ namespace Gecode { namespace Search {
   CutoffLuby::operator ++(void) {
     return scale*luby(i++);
   }
+  Cutoff*
+  CutoffLuby::copy(unsigned int) const {
+    return new CutoffLuby(*this);
+  }
 
 
   unsigned long int
@@ -85,6 +103,10 @@ namespace Gecode { namespace Search {
     n *= base;
     return static_cast<unsigned long int>(scale * n);
   }
+  Cutoff*
+  CutoffGeometric::copy(unsigned int) const {
+    return new CutoffGeometric(*this);
+  }
 
 
   unsigned long int
@@ -96,6 +118,12 @@ namespace Gecode { namespace Search {
   CutoffRandom::operator ()(void) const {
     return cur;
   }
+  Cutoff*
+  CutoffRandom::copy(unsigned int i) const {
+    CutoffRandom* c = new CutoffRandom(*this);
+    c->rnd.seed(rnd.seed() + i);
+    return c;
+  }
 
 
   unsigned long int
@@ -115,6 +143,16 @@ namespace Gecode { namespace Search {
       return ++(*c2);
     }
   }
+  Cutoff*
+  CutoffAppend::copy(unsigned int i) const {
+    Cutoff* d1 = c1->copy(i);
+    Cutoff* d2 = c2->copy(i);
+    if ((d1 == NULL) || (d2 == NULL)) {
+      delete d1; delete d2;
+      return NULL;
+    }
+    return new CutoffAppend(d1,n,d2);
+  }
 
 
   unsigned long int
@@ -127,6 +165,16 @@ namespace Gecode { namespace Search {
     std::swap(c1,c2);
     return (*c1)();
   }
+  Cutoff*
+  CutoffMerge::copy(unsigned int i) const {
+    Cutoff* d1 = c1->copy(i);
+    Cutoff* d2 = c2->copy(i);
+    if ((d1 == NULL) || (d2 == NULL)) {
+      delete d1; delete d2;
+      return NULL;
+    }
+    return new CutoffMerge(d1,d2);
+  }
 
 
   unsigned long int
@@ -142,6 +190,15 @@ namespace Gecode { namespace Search {
     }
     return cutoff;
   }
+  Cutoff*
+  CutoffRepeat::copy(unsigned int j) const {
+    Cutoff* d = c->copy(j);
+    if (d == NULL)
+      return NULL;
+    CutoffRepeat* r = new CutoffRepeat(d,n);
+    r->cutoff = cutoff; r->i = i;
+    return r;
+  }
 
 
   Cutoff*
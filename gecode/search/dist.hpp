@@ -0,0 +1,70 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Search { namespace Dist {
+
+  forceinline unsigned long int
+  Coordinator::workers(void) const {
+    return _workers;
+  }
+  forceinline unsigned long int
+  Coordinator::subtrees(void) const {
+    return _subtrees;
+  }
+  forceinline unsigned long int
+  Coordinator::steals(void) const {
+    return _steals;
+  }
+  forceinline unsigned long int
+  Coordinator::solutions(void) const {
+    return _solutions;
+  }
+  forceinline bool
+  Coordinator::complete(void) const {
+    return _complete;
+  }
+
+
+  template<class T>
+  inline
+  DFS<T>::DFS(T* s, const std::string& a, const Search::Options& o)
+    : Search::Base<T>(dfsengine(s,a,o)) {}
+
+  template<class T>
+  inline
+  BAB<T>::BAB(T* s, const std::string& a, const Search::Options& o)
+    : Search::Base<T>(babengine(s,a,o)) {}
+
+}}}
+
+// STATISTICS: search-other
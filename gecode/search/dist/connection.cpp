@@ -0,0 +1,270 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search.hh>
+
+#ifdef GECODE_SEARCH_HAS_DIST
+
+#include <gecode/search/dist/connection.hh>
+
+#include <cerrno>
+#include <cstring>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <poll.h>
+#include <unistd.h>
+
+namespace Gecode { namespace Search { namespace Dist {
+
+  namespace {
+
+    /// Flags for sending (avoid signals on closed connections)
+#ifdef MSG_NOSIGNAL
+    const int send_flags = MSG_NOSIGNAL;
+#else
+    const int send_flags = 0;
+#endif
+
+    /// Send \a n bytes from \a b on socket \a fd
+    bool
+    sendall(int fd, const char* b, size_t n) {
+      while (n > 0) {
+        ssize_t m = ::send(fd, b, n, send_flags);
+        if (m < 0) {
+          if (errno == EINTR)
+            continue;
+          return false;
+        }
+        b += m; n -= static_cast<size_t>(m);
+      }
+      return true;
+    }
+
+    /// Receive \a n bytes into \a b from socket \a fd
+    bool
+    recvall(int fd, char* b, size_t n) {
+      while (n > 0) {
+        ssize_t m = ::recv(fd, b, n, 0);
+        if (m < 0) {
+          if (errno == EINTR)
+            continue;
+          return false;
+        }
+        if (m == 0)
+          return false;
+        b += m; n -= static_cast<size_t>(m);
+      }
+      return true;
+    }
+
+    /// Whether address \a a refers to a Unix domain socket
+    bool
+    unixsocket(const std::string& a, struct sockaddr_un& sa) {
+      static const std::string prefix("unix:");
+      if (a.compare(0,prefix.size(),prefix) != 0)
+        return false;
+      std::string p = a.substr(prefix.size());
+      if (p.size() >= sizeof(sa.sun_path))
+        throw ConnectionFailed("Search::Dist::Connection");
+      memset(&sa, 0, sizeof(sa));
+      sa.sun_family = AF_UNIX;
+      strcpy(sa.sun_path, p.c_str());
+      return true;
+    }
+
+    /// Resolve TCP address \a a
+    struct addrinfo*
+    tcpsocket(const std::string& a, bool passive) {
+      std::string host("localhost");
+      std::string port(a);
+      std::string::size_type c = a.rfind(':');
+      if (c != std::string::npos) {
+        host = a.substr(0,c);
+        port = a.substr(c+1);
+      }
+      struct addrinfo hints;
+      memset(&hints, 0, sizeof(hints));
+      hints.ai_family = AF_UNSPEC;
+      hints.ai_socktype = SOCK_STREAM;
+      if (passive)
+        hints.ai_flags = AI_PASSIVE;
+      struct addrinfo* ai;
+      if (getaddrinfo(host.empty() ? NULL : host.c_str(), port.c_str(),
+                      &hints, &ai) != 0)
+        throw ConnectionFailed("Search::Dist::Connection");
+      return ai;
+    }
+
+    /// Configure connected socket \a fd
+    void
+    setup(int fd) {
+      int one = 1;
+      // Send small messages without delay (only relevant for TCP)
+      (void) setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+#ifdef SO_NOSIGPIPE
+      (void) setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+    }
+
+  }
+
+  bool
+  Connection::send(MessageType t, const Archive& e) {
+    Support::DynamicArray<unsigned int,Heap> b(heap,e.size()+2);
+    b[0] = htonl(static_cast<unsigned int>(t));
+    b[1] = htonl(static_cast<unsigned int>(e.size()));
+    for (int i=0; i<e.size(); i++)
+      b[i+2] = htonl(e[i]);
+    return sendall(fd, reinterpret_cast<const char*>(&b[0]),
+                   (e.size()+2)*sizeof(unsigned int));
+  }
+
+  bool
+  Connection::ready(void) const {
+    struct pollfd p;
+    p.fd = fd; p.events = POLLIN; p.revents = 0;
+    return poll(&p, 1, 0) > 0;
+  }
+
+  bool
+  Connection::receive(MessageType& t, Archive& e) {
+    unsigned int h[2];
+    if (!recvall(fd, reinterpret_cast<char*>(&h[0]), sizeof(h)))
+      return false;
+    t = static_cast<MessageType>(ntohl(h[0]));
+    unsigned int n = ntohl(h[1]);
+    if (n > 0U) {
+      Support::DynamicArray<unsigned int,Heap> b(heap,n);
+      if (!recvall(fd, reinterpret_cast<char*>(&b[0]),
+                   n*sizeof(unsigned int)))
+        return false;
+      for (unsigned int i=0U; i<n; i++)
+        e << ntohl(b[i]);
+    }
+    return true;
+  }
+
+  void
+  Connection::close(void) {
+    if (fd >= 0)
+      (void) ::close(fd);
+    fd = -1;
+  }
+
+  int
+  Connection::listen(const std::string& a) {
+    struct sockaddr_un sa;
+    if (unixsocket(a,sa)) {
+      int l = ::socket(AF_UNIX, SOCK_STREAM, 0);
+      if (l < 0)
+        throw ConnectionFailed("Search::Dist::Connection::listen");
+      (void) unlink(sa.sun_path);
+      if ((bind(l, reinterpret_cast<struct sockaddr*>(&sa), sizeof(sa)) < 0) ||
+          (::listen(l, SOMAXCONN) < 0)) {
+        (void) ::close(l);
+        throw ConnectionFailed("Search::Dist::Connection::listen");
+      }
+      return l;
+    }
+    struct addrinfo* ai = tcpsocket(a,true);
+    for (struct addrinfo* i=ai; i != NULL; i=i->ai_next) {
+      int l = ::socket(i->ai_family, i->ai_socktype, i->ai_protocol);
+      if (l < 0)
+        continue;
+      int one = 1;
+      (void) setsockopt(l, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+      if ((bind(l, i->ai_addr, i->ai_addrlen) == 0) &&
+          (::listen(l, SOMAXCONN) == 0)) {
+        freeaddrinfo(ai);
+        return l;
+      }
+      (void) ::close(l);
+    }
+    freeaddrinfo(ai);
+    throw ConnectionFailed("Search::Dist::Connection::listen");
+  }
+
+  int
+  Connection::accept(int l) {
+    int s;
+    do {
+      s = ::accept(l, NULL, NULL);
+    } while ((s < 0) && (errno == EINTR));
+    if (s < 0)
+      throw ConnectionFailed("Search::Dist::Connection::accept");
+    setup(s);
+    return s;
+  }
+
+  int
+  Connection::connect(const std::string& a) {
+    struct sockaddr_un sa;
+    if (unixsocket(a,sa)) {
+      int s = ::socket(AF_UNIX, SOCK_STREAM, 0);
+      if (s < 0)
+        throw ConnectionFailed("Search::Dist::Connection::connect");
+      if (::connect(s, reinterpret_cast<struct sockaddr*>(&sa),
+                    sizeof(sa)) < 0) {
+        (void) ::close(s);
+        throw ConnectionFailed("Search::Dist::Connection::connect");
+      }
+      setup(s);
+      return s;
+    }
+    struct addrinfo* ai = tcpsocket(a,false);
+    for (struct addrinfo* i=ai; i != NULL; i=i->ai_next) {
+      int s = ::socket(i->ai_family, i->ai_socktype, i->ai_protocol);
+      if (s < 0)
+        continue;
+      if (::connect(s, i->ai_addr, i->ai_addrlen) == 0) {
+        freeaddrinfo(ai);
+        setup(s);
+        return s;
+      }
+      (void) ::close(s);
+    }
+    freeaddrinfo(ai);
+    throw ConnectionFailed("Search::Dist::Connection::connect");
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-other
@@ -0,0 +1,121 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_DIST_CONNECTION_HH__
+#define __GECODE_SEARCH_DIST_CONNECTION_HH__
+
+#include <gecode/search.hh>
+
+#include <string>
+
+namespace Gecode { namespace Search { namespace Dist {
+
+  /// Messages exchanged between workers and coordinator
+  enum MessageType {
+    /// Worker to coordinator: request new work
+    MSG_REQUEST   = 0,
+    /// Worker to coordinator: donated subtree (path)
+    MSG_SPLIT     = 1,
+    /// Worker to coordinator: no subtree to donate
+    MSG_NOWORK    = 2,
+    /// Worker to coordinator: solution (path for best solution search)
+    MSG_SOLUTION  = 3,
+    /// Coordinator to worker: explore subtree (path)
+    MSG_WORK      = 4,
+    /// Coordinator to worker: donate a subtree
+    MSG_STEAL     = 5,
+    /// Coordinator to worker: new best solution (path)
+    MSG_INCUMBENT = 6,
+    /// Coordinator to worker: search is finished
+    MSG_STOP      = 7
+  };
+
+  /**
+   * \brief Connection between a worker and the coordinator
+   *
+   * A message consists of its type, the number of words, and the
+   * words of an archive, all sent in network byte order.
+   */
+  class Connection {
+  protected:
+    /// The socket
+    int fd;
+  public:
+    /// Initialize with socket \a s
+    Connection(int s=-1);
+    /// Return socket
+    int socket(void) const;
+    /// Send message of type \a t with contents \a e
+    bool send(MessageType t, const Archive& e);
+    /// Send message of type \a t without contents
+    bool send(MessageType t);
+    /// Test whether a message can be received without blocking
+    bool ready(void) const;
+    /// Receive message into \a t and \a e (blocking), false if closed
+    bool receive(MessageType& t, Archive& e);
+    /// Close connection
+    void close(void);
+
+    /**
+     * \brief Create listening socket for address \a a
+     *
+     * The address \a a is either \c unix:<path> for a Unix domain
+     * socket or <host>:<port> or <port> for a TCP socket, where
+     * the host defaults to \c localhost.
+     */
+    static int listen(const std::string& a);
+    /// Accept a connection on listening socket \a l
+    static int accept(int l);
+    /// Connect to address \a a (see listen())
+    static int connect(const std::string& a);
+  };
+
+  forceinline
+  Connection::Connection(int s) : fd(s) {}
+
+  forceinline int
+  Connection::socket(void) const {
+    return fd;
+  }
+
+  forceinline bool
+  Connection::send(MessageType t) {
+    Archive e;
+    return send(t,e);
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-other
@@ -0,0 +1,218 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search.hh>
+
+#ifdef GECODE_SEARCH_HAS_DIST
+
+#include <gecode/search/dist/connection.hh>
+
+#include <vector>
+#include <deque>
+
+#include <poll.h>
+#include <unistd.h>
+
+namespace Gecode { namespace Search { namespace Dist {
+
+  namespace {
+
+    /// Worker as seen by the coordinator
+    class Peer {
+    public:
+      /// Connection to the worker
+      Connection c;
+      /// Whether the worker waits for work
+      bool idle;
+      /// Whether a request to donate is pending
+      bool steal;
+      /// Whether the worker had nothing to donate recently
+      bool dry;
+      /// Initialize for socket \a s
+      Peer(int s) : c(s), idle(false), steal(false), dry(false) {}
+    };
+
+  }
+
+  Coordinator::Coordinator(const std::string& a, unsigned int n0)
+    : l(Connection::listen(a)), n(n0), _workers(0UL), _subtrees(0UL),
+      _steals(0UL), _solutions(0UL), _complete(true) {}
+
+  void
+  Coordinator::run(void) {
+    std::vector<Peer> peers;
+    // Subtrees not yet handed out, initially the root
+    std::deque<Archive> work;
+    {
+      Archive e;
+      ChoicePath().archive(e);
+      work.push_back(e);
+    }
+    // Path of the last solution reported for best solution search
+    Archive incumbent;
+    // Next worker to ask for a donation
+    unsigned int victim = 0U;
+    while (true) {
+      // Hand out subtrees to idle workers
+      for (unsigned int i=0U; (i<peers.size()) && !work.empty(); i++)
+        if (peers[i].idle && (peers[i].c.socket() >= 0)) {
+          if (peers[i].c.send(MSG_WORK,work.front())) {
+            peers[i].idle = false;
+            _subtrees++;
+            work.pop_front();
+          } else {
+            // The worker is gone, keep the subtree for another one
+            peers[i].c.close();
+          }
+        }
+      // Count idle workers and pending donations
+      unsigned int idle = 0U, pending = 0U, dry = 0U;
+      for (unsigned int i=0U; i<peers.size(); i++)
+        if (peers[i].idle)
+          idle++;
+        else if (peers[i].steal)
+          pending++;
+        else if (peers[i].dry)
+          dry++;
+      // Search is finished if all workers wait for work and there is none
+      if ((_workers >= n) && (_subtrees > 0UL) && work.empty() &&
+          (idle == peers.size())) {
+        for (unsigned int i=0U; i<peers.size(); i++)
+          (void) peers[i].c.send(MSG_STOP);
+        // Discard late replies until the workers hang up
+        for (unsigned int i=0U; i<peers.size(); i++) {
+          while (true) {
+            MessageType t; Archive e;
+            if (!peers[i].c.receive(t,e))
+              break;
+          }
+          peers[i].c.close();
+        }
+        // Further workers cannot connect
+        (void) close(l);
+        l = -1;
+        return;
+      }
+      // Ask busy workers to donate subtrees for idle workers
+      for (unsigned int n=peers.size(), v=victim, k=0U;
+           (pending < idle) && (k < n); k++) {
+        Peer& p = peers[(v + k) % n];
+        if (!p.idle && !p.steal && !p.dry) {
+          if (p.c.send(MSG_STEAL)) {
+            p.steal = true; pending++; _steals++;
+          }
+          victim = (v + k + 1) % n;
+        }
+      }
+      // Wait for connections and messages
+      std::vector<struct pollfd> fds(peers.size()+1);
+      fds[0].fd = l; fds[0].events = POLLIN; fds[0].revents = 0;
+      for (unsigned int i=0U; i<peers.size(); i++) {
+        fds[i+1].fd = peers[i].c.socket();
+        fds[i+1].events = POLLIN; fds[i+1].revents = 0;
+      }
+      int timeout = ((idle > pending) && (dry > 0U)) ?
+        static_cast<int>(Config::dist_retry) : -1;
+      int r = poll(&fds[0], fds.size(), timeout);
+      if (r == 0) {
+        // Ask workers without work again
+        for (unsigned int i=0U; i<peers.size(); i++)
+          peers[i].dry = false;
+        continue;
+      }
+      if (r < 0)
+        continue;
+      // Process messages
+      std::vector<Peer> alive;
+      for (unsigned int i=0U; i<peers.size(); i++) {
+        Peer& p = peers[i];
+        if (p.c.socket() < 0)
+          continue;
+        if (fds[i+1].revents != 0) {
+          MessageType t; Archive e;
+          if (!p.c.receive(t,e)) {
+            // Subtree explored by the worker is lost
+            if (!p.idle)
+              _complete = false;
+            p.c.close();
+            continue;
+          }
+          switch (t) {
+          case MSG_REQUEST:
+            p.idle = true; p.steal = false;
+            break;
+          case MSG_SPLIT:
+            p.steal = false;
+            work.push_back(e);
+            break;
+          case MSG_NOWORK:
+            p.steal = false; p.dry = true;
+            break;
+          case MSG_SOLUTION:
+            _solutions++;
+            if (e.size() > 0) {
+              // Broadcast solution for best solution search
+              incumbent = e;
+              for (unsigned int j=0U; j<peers.size(); j++)
+                if (j != i)
+                  (void) peers[j].c.send(MSG_INCUMBENT,e);
+            }
+            break;
+          default:
+            throw ConnectionFailed("Search::Dist::Coordinator::run");
+          }
+        }
+        alive.push_back(p);
+      }
+      peers.swap(alive);
+      // Accept new workers and inform them about the best solution
+      if (fds[0].revents != 0) {
+        Peer p(Connection::accept(l));
+        _workers++;
+        if (incumbent.size() > 0)
+          (void) p.c.send(MSG_INCUMBENT,incumbent);
+        peers.push_back(p);
+      }
+    }
+  }
+
+  Coordinator::~Coordinator(void) {
+    if (l >= 0)
+      (void) close(l);
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-other
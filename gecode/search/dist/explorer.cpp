@@ -0,0 +1,283 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search.hh>
+
+#ifdef GECODE_SEARCH_HAS_DIST
+
+#include <gecode/search/dist/explorer.hh>
+
+namespace Gecode { namespace Search { namespace Dist {
+
+  Explorer::Explorer(Space* s, const std::string& a, const Options& o,
+                     bool bb)
+    : opt(o), best(bb), c(Connection::connect(a)), root(NULL), ds(heap),
+      cur(NULL), cmark(0UL), b(NULL), mark(0UL), sol(NULL), done(false),
+      polls(0U) {
+    if ((s == NULL) || (s->status(*this) == SS_FAILED)) {
+      // All subtrees received will be failed
+      fail++;
+      if (!opt.clone)
+        delete s;
+    } else {
+      root = snapshot(s,opt);
+    }
+  }
+
+  ChoicePath
+  Explorer::path(int n) const {
+    ChoicePath p(prefix);
+    for (int i=0; i<n; i++)
+      p.push(*ds[i].c, ds[i].alt);
+    return p;
+  }
+
+  void
+  Explorer::send(MessageType t, const Archive& e) {
+    if (!c.send(t,e))
+      throw ConnectionFailed("Search::Dist::Explorer::send");
+  }
+
+  void
+  Explorer::donate(void) {
+    for (int i=0; i<ds.entries(); i++) {
+      Node& n = ds[i];
+      if (n.alt+1 < n.lst) {
+        n.lst--;
+        ChoicePath p(path(i));
+        p.push(*n.c, n.lst);
+        if (n.alt+1 == n.lst) {
+          delete n.s; n.s = NULL;
+        }
+        Archive e;
+        p.archive(e);
+        send(MSG_SPLIT,e);
+        return;
+      }
+    }
+    send(MSG_NOWORK,Archive());
+  }
+
+  void
+  Explorer::incumbent(Archive& e) {
+    if (root == NULL)
+      return;
+    ChoicePath p(e);
+    Space* x = p.replay(*root);
+    /*
+     * The path might only lead to a solution together with the bound
+     * the sending worker had to respect. That bound is never better
+     * than the best solution known here, so constraining by the latter
+     * both completes the solution and rejects it if it is not better.
+     */
+    if (b != NULL)
+      x->constrain(*b);
+    if (x->status(*this) != SS_SOLVED) {
+      delete x; return;
+    }
+    (void) x->choice();
+    delete b; b = x; mark++;
+    delete sol; sol = x->clone();
+  }
+
+  void
+  Explorer::process(MessageType t, Archive& e) {
+    switch (t) {
+    case MSG_STEAL:
+      donate(); break;
+    case MSG_INCUMBENT:
+      incumbent(e); break;
+    case MSG_STOP:
+      // Hang up so that the coordinator can finish
+      done = true; c.close(); break;
+    default:
+      throw ConnectionFailed("Search::Dist::Explorer::process");
+    }
+  }
+
+  void
+  Explorer::receive(void) {
+    while (!done && c.ready()) {
+      MessageType t; Archive e;
+      if (!c.receive(t,e))
+        throw ConnectionFailed("Search::Dist::Explorer::receive");
+      process(t,e);
+    }
+  }
+
+  void
+  Explorer::request(void) {
+    send(MSG_REQUEST,Archive());
+    while (!done) {
+      MessageType t; Archive e;
+      if (!c.receive(t,e))
+        throw ConnectionFailed("Search::Dist::Explorer::request");
+      if (t == MSG_WORK) {
+        prefix = ChoicePath(e);
+        if (root != NULL) {
+          cur = prefix.replay(*root);
+          cmark = 0UL;
+        }
+        return;
+      }
+      process(t,e);
+    }
+  }
+
+  bool
+  Explorer::backtrack(void) {
+    while (!ds.empty()) {
+      Node& n = ds.top();
+      if (n.alt+1 < n.lst) {
+        n.alt++;
+        if (n.alt+1 == n.lst) {
+          cur = n.s; n.s = NULL;
+        } else {
+          cur = n.s->clone();
+        }
+        cmark = n.mark;
+        cur->commit(*n.c, n.alt);
+        return true;
+      }
+      assert(n.s == NULL);
+      delete n.c;
+      (void) ds.pop();
+    }
+    return false;
+  }
+
+  Space*
+  Explorer::next(void) {
+    start();
+    while (true) {
+      if (sol != NULL) {
+        Space* s = sol; sol = NULL;
+        return s;
+      }
+      if (done || stop(opt))
+        return NULL;
+      if (cur == NULL) {
+        if (!backtrack())
+          request();
+        continue;
+      }
+      if (++polls >= Config::dist_poll) {
+        polls = 0U;
+        receive();
+        continue;
+      }
+      if (best && (b != NULL) && (cmark < mark)) {
+        cur->constrain(*b);
+        cmark = mark;
+      }
+      node++;
+      switch (cur->status(*this)) {
+      case SS_FAILED:
+        fail++;
+        delete cur;
+        cur = NULL;
+        break;
+      case SS_SOLVED:
+        {
+          // Deletes all pending branchers
+          (void) cur->choice();
+          Space* s = cur;
+          cur = NULL;
+          Archive e;
+          if (best) {
+            path(ds.entries()).archive(e);
+            delete b; b = s->clone(); mark++;
+          }
+          send(MSG_SOLUTION,e);
+          return s;
+        }
+      case SS_BRANCH:
+        {
+          Node n;
+          n.c = cur->choice();
+          n.alt = 0U;
+          n.lst = n.c->alternatives();
+          n.s = (n.lst > 1U) ? cur->clone() : NULL;
+          n.mark = cmark;
+          ds.push(n);
+          stack_depth(static_cast<unsigned long int>(ds.entries()));
+          cur->commit(*n.c,0U);
+          break;
+        }
+      default:
+        GECODE_NEVER;
+      }
+    }
+    GECODE_NEVER;
+    return NULL;
+  }
+
+  Statistics
+  Explorer::statistics(void) const {
+    return *this;
+  }
+
+  bool
+  Explorer::stopped(void) const {
+    return Worker::stopped();
+  }
+
+  Explorer::~Explorer(void) {
+    while (!ds.empty()) {
+      Node n = ds.pop();
+      delete n.s;
+      delete n.c;
+    }
+    delete cur;
+    delete b;
+    delete sol;
+    delete root;
+    c.close();
+  }
+
+
+  Engine*
+  dfsengine(Space* s, const std::string& a, const Options& o) {
+    return new Explorer(s,a,o.expand(),false);
+  }
+
+  Engine*
+  babengine(Space* s, const std::string& a, const Options& o) {
+    return new Explorer(s,a,o.expand(),true);
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-other
@@ -0,0 +1,127 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_DIST_EXPLORER_HH__
+#define __GECODE_SEARCH_DIST_EXPLORER_HH__
+
+#include <gecode/search.hh>
+#include <gecode/search/support.hh>
+#include <gecode/search/worker.hh>
+#include <gecode/search/dist/connection.hh>
+
+namespace Gecode { namespace Search { namespace Dist {
+
+  /**
+   * \brief Worker for distributed depth-first and branch-and-bound search
+   *
+   * The worker explores the subtrees it receives from the coordinator
+   * with full copying. Each node on the stack keeps its choice so that
+   * the path to any node can be archived, either for donating an open
+   * alternative or for reporting a solution.
+   */
+  class Explorer : public Engine, public Worker {
+  protected:
+    /// Node on the stack
+    class Node {
+    public:
+      /// Space for remaining alternatives (NULL if there are none)
+      Space* s;
+      /// Choice of the node
+      const Choice* c;
+      /// Alternative currently explored
+      unsigned int alt;
+      /// Alternatives from this one on are donated or do not exist
+      unsigned int lst;
+      /// Mark of the best solution \a s has been constrained with
+      unsigned long int mark;
+    };
+    /// Search options
+    Options opt;
+    /// Whether to perform best solution search
+    const bool best;
+    /// Connection to the coordinator
+    Connection c;
+    /// Root space (NULL if failed)
+    Space* root;
+    /// Path from the root to the current subtree
+    ChoicePath prefix;
+    /// Stack of nodes in the current subtree
+    Support::DynamicStack<Node,Heap> ds;
+    /// Current space being explored
+    Space* cur;
+    /// Mark of the best solution \a cur has been constrained with
+    unsigned long int cmark;
+    /// Best solution found so far
+    Space* b;
+    /// Mark of the best solution (incremented for each new one)
+    unsigned long int mark;
+    /// Better solution found by another worker to be returned
+    Space* sol;
+    /// Whether the coordinator has finished search
+    bool done;
+    /// Number of nodes explored since last checking for messages
+    unsigned int polls;
+    /// Return path to the current alternative of the node at depth \a n
+    ChoicePath path(int n) const;
+    /// Donate the open alternative closest to the root
+    void donate(void);
+    /// Update best solution from path in \a e
+    void incumbent(Archive& e);
+    /// Process message \a t with contents \a e
+    void process(MessageType t, Archive& e);
+    /// Process all messages that have arrived
+    void receive(void);
+    /// Send message \a t with contents \a e
+    void send(MessageType t, const Archive& e);
+    /// Continue with next open alternative, false if there is none
+    bool backtrack(void);
+    /// Request new subtree from coordinator
+    void request(void);
+  public:
+    /// Initialize for space \a s, coordinator address \a a, and options \a o
+    Explorer(Space* s, const std::string& a, const Options& o, bool best);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Destructor
+    virtual ~Explorer(void);
+  };
+
+}}}
+
+#endif
+
+// STATISTICS: search-other
@@ -48,6 +48,9 @@ namespace Gecode { namespace Search {
   NoBest::NoBest(const char* l)
     : Exception(l,"Best solution search is not supported") {}
 
+  ConnectionFailed::ConnectionFailed(const char* l)
+    : Exception(l,"Communication for distributed search failed") {}
+
 }}
 
 // STATISTICS: search-other
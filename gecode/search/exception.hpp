@@ -62,6 +62,12 @@ namespace Gecode { namespace Search {
     /// Initialize with location \a l
     NoBest(const char* l);
   };
+  /// %Exception: Communication for distributed search failed
+  class GECODE_SEARCH_EXPORT ConnectionFailed : public Exception {
+  public:
+    /// Initialize with location \a l
+    ConnectionFailed(const char* l);
+  };
   //@}
 }}
 
@@ -217,6 +217,211 @@ namespace Gecode { namespace Search {
     return sizeof(*this);
   }
 
+
+  /// Path of choices read from an archive
+  class ArchivedPath : public NoGoods {
+  public:
+    /// Edge of the path
+    class Edge {
+    public:
+      /// Choice
+      const Choice* c;
+      /// Alternative
+      unsigned int a;
+      /// Whether the alternative is rightmost
+      bool r;
+      /// Return choice
+      const Choice* choice(void) const;
+      /// Return alternative
+      unsigned int truealt(void) const;
+      /// Test whether alternative is rightmost
+      bool rightmost(void) const;
+    };
+    /// Edges of the path
+    class Edges {
+    public:
+      /// The edges
+      Edge* e;
+      /// Number of edges
+      int n;
+      /// Return number of edges
+      int entries(void) const;
+      /// Return edge \a i
+      const Edge& operator [](int i) const;
+    };
+    /// Edges of the path
+    Edges ds;
+    /// Return depth limit for no-goods
+    unsigned int ngdl(void) const;
+  };
+
+  forceinline const Choice*
+  ArchivedPath::Edge::choice(void) const {
+    return c;
+  }
+  forceinline unsigned int
+  ArchivedPath::Edge::truealt(void) const {
+    return a;
+  }
+  forceinline bool
+  ArchivedPath::Edge::rightmost(void) const {
+    return r;
+  }
+  forceinline int
+  ArchivedPath::Edges::entries(void) const {
+    return n;
+  }
+  forceinline const ArchivedPath::Edge&
+  ArchivedPath::Edges::operator [](int i) const {
+    return e[i];
+  }
+  forceinline unsigned int
+  ArchivedPath::ngdl(void) const {
+    return static_cast<unsigned int>(ds.n);
+  }
+
+
+  NoGoodStore::NoGoodStore(unsigned int n)
+    : es(heap.alloc<Entry>(n)), n_es(0U), cap(n), clock(0UL) {}
+
+  bool
+  NoGoodStore::put(unsigned int w, const NoGoods& ng) {
+    Archive e;
+    unsigned int d = ng.archive(e);
+    if ((d == 0U) || (cap == 0U))
+      return false;
+    std::size_t h = static_cast<std::size_t>(e.size());
+    for (int j=0; j<e.size(); j++)
+      cmb_hash(h, e[j]);
+    m.acquire();
+    // Reject paths already stored
+    for (unsigned int i=0U; i<n_es; i++)
+      if ((es[i].h == h) && (es[i].n == e.size())) {
+        int j=0;
+        while ((j < e.size()) && (es[i].a[j] == e[j]))
+          j++;
+        if (j == e.size()) {
+          m.release();
+          return false;
+        }
+      }
+    unsigned int i;
+    if (n_es < cap) {
+      i = n_es++;
+    } else {
+      // Find path with the worst score
+      i = 0U;
+      unsigned long int s = es[0].depth + (clock - es[0].t);
+      for (unsigned int j=1U; j<n_es; j++)
+        if (es[j].depth + (clock - es[j].t) > s) {
+          i = j; s = es[j].depth + (clock - es[j].t);
+        }
+      // Only replace paths that are worse than the new one
+      if (s <= d) {
+        m.release();
+        return false;
+      }
+      heap.free<unsigned int>(es[i].a,es[i].n);
+    }
+    clock++;
+    es[i].a = heap.alloc<unsigned int>(e.size());
+    for (int j=0; j<e.size(); j++)
+      es[i].a[j] = e[j];
+    es[i].n = e.size();
+    es[i].h = h;
+    es[i].depth = d;
+    es[i].t = clock;
+    es[i].w = w;
+    m.release();
+    return true;
+  }
+
+  unsigned long int
+  NoGoodStore::post(Space& home, unsigned int w, unsigned long int& t,
+                    unsigned long int& n) {
+    // Copy the paths while holding the lock
+    Archive e;
+    unsigned long int k = 0UL;
+    m.acquire();
+    for (unsigned int i=0U; i<n_es; i++)
+      if ((es[i].w != w) && (es[i].t > t)) {
+        e << es[i].n;
+        for (int j=0; j<es[i].n; j++)
+          e << es[i].a[j];
+        k++;
+      }
+    t = clock;
+    m.release();
+
+    unsigned long int p = 0UL;
+    for (unsigned long int i=0UL; (i<k) && !home.failed(); i++) {
+      Archive a;
+      int s; e >> s;
+      for (int j=0; j<s; j++)
+        a << e.get();
+      int d; a >> d;
+      Region r;
+      ArchivedPath ap;
+      ap.ds.e = r.alloc<ArchivedPath::Edge>(d);
+      ap.ds.n = 0;
+      try {
+        for (int j=0; j<d; j++) {
+          ArchivedPath::Edge& ed = ap.ds.e[j];
+          a >> ed.a >> ed.r;
+          ed.c = home.choice(a);
+          ap.ds.n++;
+        }
+      } catch (SpaceNoBrancher&) {
+        // The brancher is gone, the no-goods from the prefix remain valid
+      }
+      if (ap.ds.n > 0) {
+        if (NoGoodsProp::post(home,ap) == ES_FAILED)
+          home.fail();
+        n += ap.ng();
+        p++;
+      }
+      for (int j=0; j<ap.ds.n; j++)
+        delete ap.ds.e[j].c;
+    }
+    return p;
+  }
+
+  NoGoodStore::~NoGoodStore(void) {
+    for (unsigned int i=0U; i<n_es; i++)
+      heap.free<unsigned int>(es[i].a,es[i].n);
+    heap.free<Entry>(es,cap);
+  }
+
+
+  SharedNoGoods::SharedNoGoods(NoGoodStore& s, unsigned int w0)
+    : store(s), w(w0), t(0UL), own(&NoGoods::eng),
+      n_import(0UL), n_shared(0UL) {}
+
+  bool
+  SharedNoGoods::put(NoGoods& ng) {
+    own = &ng;
+    return store.put(w,ng);
+  }
+
+  void
+  SharedNoGoods::post(Space& home) const {
+    SharedNoGoods& sng = const_cast<SharedNoGoods&>(*this);
+    own->ng(0);
+    own->post(home);
+    unsigned long int n = 0UL;
+    if (!home.failed())
+      sng.n_import += store.post(home,w,sng.t,n);
+    sng.n_shared += n;
+    sng.ng(own->ng() + n);
+  }
+
+  void
+  SharedNoGoods::update(Statistics& s) {
+    s.nogood_import += n_import;
+    s.nogood_shared += n_shared;
+    n_import = 0UL; n_shared = 0UL;
+  }
+
 }}
 
 // STATISTICS: search-other
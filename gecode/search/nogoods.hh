@@ -88,6 +88,93 @@ namespace Gecode { namespace Search {
     virtual size_t dispose(Space& home);
   };
 
+  /**
+   * \brief Bounded store of no-goods shared by several engines
+   *
+   * No-goods are kept as archived paths of choices so that they can
+   * be posted in any space with the same branchers. The quality of a
+   * path is its depth, as shallow paths give short no-goods (similar
+   * to the literal block distance of learned clauses). A path ages
+   * with every path added after it; if the store is full, the path
+   * with the largest sum of depth and age is evicted. Paths already
+   * in the store are not added again.
+   */
+  class GECODE_SEARCH_EXPORT NoGoodStore {
+  protected:
+    /// A stored path
+    class Entry {
+    public:
+      /// Archived path
+      unsigned int* a;
+      /// Size of archived path
+      int n;
+      /// Hash value of archived path
+      std::size_t h;
+      /// Depth of path
+      unsigned int depth;
+      /// Time when the path was added
+      unsigned long int t;
+      /// Engine that added the path
+      unsigned int w;
+    };
+    /// Mutex for access
+    Support::Mutex m;
+    /// Stored paths
+    Entry* es;
+    /// Number of stored paths
+    unsigned int n_es;
+    /// Maximal number of stored paths
+    unsigned int cap;
+    /// Number of paths added so far
+    unsigned long int clock;
+  public:
+    /// Initialize for at most \a n paths
+    NoGoodStore(unsigned int n);
+    /// Add no-goods \a ng from engine \a w, return whether they were added
+    bool put(unsigned int w, const NoGoods& ng);
+    /**
+     * \brief Post no-goods added by engines other than \a w after time \a t
+     *
+     * Updates \a t, returns the number of paths posted and increments
+     * \a n by the number of no-goods posted.
+     */
+    unsigned long int post(Space& home, unsigned int w, unsigned long int& t,
+                           unsigned long int& n);
+    /// Delete store
+    ~NoGoodStore(void);
+  };
+
+  /**
+   * \brief No-goods of an engine combined with no-goods from a store
+   *
+   * Posting the no-goods posts the engine's own no-goods and then all
+   * no-goods added to the store by other engines since the last time.
+   */
+  class GECODE_SEARCH_EXPORT SharedNoGoods : public NoGoods {
+  protected:
+    /// The store
+    NoGoodStore& store;
+    /// Number of the engine
+    unsigned int w;
+    /// Time of last import from the store
+    unsigned long int t;
+    /// The engine's own no-goods
+    NoGoods* own;
+    /// Number of paths imported
+    unsigned long int n_import;
+    /// Number of no-goods posted from imported paths
+    unsigned long int n_shared;
+  public:
+    /// Initialize for engine \a w using store \a s
+    SharedNoGoods(NoGoodStore& s, unsigned int w);
+    /// Add no-goods \a ng to the store and use them as own no-goods
+    bool put(NoGoods& ng);
+    /// Post own no-goods and no-goods from the store
+    virtual void post(Space& home) const;
+    /// Add import statistics to \a s and reset them
+    void update(Statistics& s);
+  };
+
 }}
 
 #include <gecode/search/nogoods.hpp>
@@ -40,6 +40,9 @@ namespace Gecode { namespace Search {
       c_d(Config::c_d), a_d(Config::a_d),
       d_l(Config::d_l),
       assets(0), slice(Config::slice), nogoods_limit(0),
+      nogoods_share(Config::nogoods_share),
+      steal(Config::steal), subproblems(Config::subproblems),
+      relax(Config::relax),
       stop(nullptr), cutoff(nullptr), tracer(nullptr) {}
 
 }}
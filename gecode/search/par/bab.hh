@@ -58,15 +58,44 @@ namespace Gecode { namespace Search { namespace Par {
     using Engine<Tracer>::solutions;
     using Engine<Tracer>::terminate;
     using Engine<Tracer>::workers;
+    using Engine<Tracer>::eps;
+    using Engine<Tracer>::decompose;
+    using Engine<Tracer>::discard;
+    using Engine<Tracer>::sp_stat;
     using Engine<Tracer>::C_WAIT;
     using Engine<Tracer>::C_RESET;
     using Engine<Tracer>::C_TERMINATE;
     using Engine<Tracer>::C_WORK;
+    /**
+     * \brief Best solution shared by the engine and all workers
+     *
+     * An incumbent is never modified after creation. Hence, all workers
+     * can constrain their spaces by the same solution without cloning
+     * it, and the last worker that drops its reference deletes it.
+     *
+     */
+    class Incumbent : public HeapAllocated {
+    protected:
+      /// The best solution
+      Space* _s;
+      /// Reference count
+      Support::RefCount rc;
+    public:
+      /// Initialize with solution \a s
+      Incumbent(Space* s);
+      /// Return the best solution
+      const Space& space(void) const;
+      /// Acquire an additional reference
+      Incumbent* copy(void);
+      /// Release reference to \a i (if not NULL)
+      static void release(Incumbent* i);
+      /// Delete solution
+      ~Incumbent(void);
+    };
     /// %Parallel branch-and-bound search worker
     class Worker : public Engine<Tracer>::Worker {
     protected:
       using Engine<Tracer>::Worker::_engine;
-      using Engine<Tracer>::Worker::m;
       using Engine<Tracer>::Worker::path;
       using Engine<Tracer>::Worker::cur;
       using Engine<Tracer>::Worker::d;
@@ -76,19 +105,35 @@ namespace Gecode { namespace Search { namespace Par {
       using Engine<Tracer>::Worker::start;
       using Engine<Tracer>::Worker::tracer;
       using Engine<Tracer>::Worker::stop;
+      using Engine<Tracer>::Worker::steal_attempt;
+      using Engine<Tracer>::Worker::steal_success;
+      using Engine<Tracer>::Worker::victims;
+      using Engine<Tracer>::Worker::n_victims;
+      using Engine<Tracer>::Worker::victim;
+      using Engine<Tracer>::Worker::serve;
+      using Engine<Tracer>::Worker::take;
+      using Engine<Tracer>::Worker::sp;
       /// Number of entries not yet constrained to be better
       int mark;
       /// Best solution found so far
-      Space* best;
+      Incumbent* best;
+      /// Mutex for access to a better solution announced by the engine
+      Support::Mutex m;
+      /// Better solution announced by the engine but not yet accepted
+      Incumbent* _better;
+      /// Whether a better solution has been announced
+      std::atomic<bool> _announced;
+      /// Accept a better solution that has been announced (if any)
+      void accept(void);
     public:
-      /// Initialize for space \a s with engine \a e
-      Worker(Space* s, BAB& e);
+      /// Initialize for space \a s with engine \a e as worker \a i
+      Worker(Space* s, BAB& e, unsigned int i);
       /// Provide access to engine
       BAB& engine(void) const;
       /// Start execution of worker
       virtual void run(void);
-      /// Accept better solution \a b
-      void better(Space* b);
+      /// Announce better solution \a b
+      void better(Incumbent* b);
       /// Try to find some work
       void find(void);
       /// Reset engine to restart at space \a s
@@ -99,7 +144,9 @@ namespace Gecode { namespace Search { namespace Par {
     /// Array of worker references
     Worker** _worker;
     /// Best solution so far
-    Space* best;
+    Incumbent* best;
+    /// Make \a b the best solution and announce it to all workers
+    void better(Incumbent* b);
   public:
     /// Provide access to worker \a i
     Worker* worker(unsigned int i) const;
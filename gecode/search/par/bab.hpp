@@ -33,6 +33,37 @@
 
 namespace Gecode { namespace Search { namespace Par {
 
+  /*
+   * Shared best solution
+   */
+  template<class Tracer>
+  forceinline
+  BAB<Tracer>::Incumbent::Incumbent(Space* s)
+    : _s(s), rc(1UL) {}
+  template<class Tracer>
+  forceinline const Space&
+  BAB<Tracer>::Incumbent::space(void) const {
+    return *_s;
+  }
+  template<class Tracer>
+  forceinline typename BAB<Tracer>::Incumbent*
+  BAB<Tracer>::Incumbent::copy(void) {
+    rc.inc();
+    return this;
+  }
+  template<class Tracer>
+  forceinline void
+  BAB<Tracer>::Incumbent::release(Incumbent* i) {
+    if ((i != NULL) && i->rc.dec())
+      delete i;
+  }
+  template<class Tracer>
+  forceinline
+  BAB<Tracer>::Incumbent::~Incumbent(void) {
+    delete _s;
+  }
+
+
   /*
    * Engine: basic access routines
    */
@@ -52,12 +83,16 @@ namespace Gecode { namespace Search { namespace Par {
   BAB<Tracer>::Worker::reset(Space* s, unsigned int ngdl) {
     tracer.round();
     delete cur;
-    delete best;
+    Incumbent::release(best);
     best = NULL;
+    Incumbent::release(_better);
+    _better = NULL;
+    _announced.store(false, std::memory_order_relaxed);
     path.reset((s == NULL) ? 0 : ngdl);
     d = 0;
     mark = 0;
     idle = false;
+    sp = false;
     if ((s == NULL) || (s->status(*this) == SS_FAILED)) {
       delete s;
       cur = NULL;
@@ -73,8 +108,9 @@ namespace Gecode { namespace Search { namespace Par {
    */
   template<class Tracer>
   forceinline
-  BAB<Tracer>::Worker::Worker(Space* s, BAB& e)
-    : Engine<Tracer>::Worker(s,e), mark(0), best(NULL) {}
+  BAB<Tracer>::Worker::Worker(Space* s, BAB& e, unsigned int i)
+    : Engine<Tracer>::Worker(s,e,i), mark(0), best(NULL),
+      _better(NULL), _announced(false) {}
 
   template<class Tracer>
   forceinline
@@ -85,11 +121,18 @@ namespace Gecode { namespace Search { namespace Par {
     // Create workers
     _worker = static_cast<Worker**>
       (heap.ralloc(workers() * sizeof(Worker*)));
-    // The first worker gets the entire search tree
-    _worker[0] = new Worker(s,*this);
-    // All other workers start with no work
-    for (unsigned int i=1U; i<workers(); i++)
-      _worker[i] = new Worker(NULL,*this);
+    if (eps()) {
+      // All workers take subproblems from the decomposed root
+      for (unsigned int i=0U; i<workers(); i++)
+        _worker[i] = new Worker(NULL,*this,i);
+      decompose(s,opt().clone);
+    } else {
+      // The first worker gets the entire search tree
+      _worker[0] = new Worker(s,*this,0U);
+      // All other workers start with no work
+      for (unsigned int i=1U; i<workers(); i++)
+        _worker[i] = new Worker(NULL,*this,i);
+    }
     // Block all workers
     block();
     // Create and start threads
@@ -103,35 +146,51 @@ namespace Gecode { namespace Search { namespace Par {
    */
   template<class Tracer>
   forceinline void
-  BAB<Tracer>::Worker::better(Space* b) {
+  BAB<Tracer>::Worker::better(Incumbent* b) {
+    m.acquire();
+    Incumbent::release(_better);
+    _better = b->copy();
+    _announced.store(true, std::memory_order_release);
+    m.release();
+  }
+  template<class Tracer>
+  forceinline void
+  BAB<Tracer>::Worker::accept(void) {
+    // Quick check whether a better solution has been announced
+    if (!_announced.load(std::memory_order_acquire))
+      return;
     m.acquire();
-    delete best;
-    best = b->clone();
+    Incumbent::release(best);
+    best = _better;
+    _better = NULL;
+    _announced.store(false, std::memory_order_relaxed);
+    m.release();
     mark = path.entries();
     if (cur != NULL)
-      cur->constrain(*best);
-    m.release();
+      cur->constrain(best->space());
+  }
+  template<class Tracer>
+  forceinline void
+  BAB<Tracer>::better(Incumbent* b) {
+    Incumbent::release(best);
+    best = b;
+    // Announce better solutions
+    for (unsigned int i=0U; i<workers(); i++)
+      worker(i)->better(best);
   }
   template<class Tracer>
   forceinline void
   BAB<Tracer>::solution(Space* s) {
     m_search.acquire();
     if (best != NULL) {
-      s->constrain(*best);
+      s->constrain(best->space());
       if (s->status() == SS_FAILED) {
         delete s;
         m_search.release();
         return;
-      } else {
-        delete best;
-        best = s->clone();
       }
-    } else {
-      best = s->clone();
     }
-    // Announce better solutions
-    for (unsigned int i=0U; i<workers(); i++)
-      worker(i)->better(best);
+    better(new Incumbent(s->clone()));
     bool bs = signal();
     solutions.push(s);
     if (bs)
@@ -147,12 +206,23 @@ namespace Gecode { namespace Search { namespace Par {
   forceinline void
   BAB<Tracer>::Worker::find(void) {
     // Try to find new work (even if there is none)
-    for (unsigned int i=0U; i<engine().workers(); i++) {
+    victims();
+    unsigned long int n_a = 0ul;
+    for (unsigned int i=0U; i<n_victims(); i++) {
       unsigned long int r_d = 0ul;
-      typename Engine<Tracer>::Worker* wi = engine().worker(i);
-      if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
+      typename Engine<Tracer>::Worker* wi = engine().worker(victim(i));
+      /*
+       * Make a quick check whether the worker might have work
+       *
+       * If that is not true any longer, the worker will be asked
+       * again eventually.
+       */
+      if (!wi->work())
+        continue;
+      n_a++;
+      if (Space* s = wi->steal(*this,r_d)) {
         // Reset this guy
-        m.acquire();
+        accept();
         idle = false;
         // Not idle but also does not have the root of the tree
         path.ngdl(0);
@@ -160,14 +230,16 @@ namespace Gecode { namespace Search { namespace Par {
         cur = s;
         mark = 0;
         if (best != NULL)
-          cur->constrain(*best);
+          cur->constrain(best->space());
         Statistics t = *this;
         Search::Worker::reset(r_d);
         (*this) += t;
-        m.release();
+        steal_attempt += n_a;
+        steal_success++;
         return;
       }
     }
+    steal_attempt += n_a;
   }
 
   /*
@@ -176,7 +248,7 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   Statistics
   BAB<Tracer>::statistics(void) const {
-    Statistics s;
+    Statistics s = sp_stat;
     for (unsigned int i=0U; i<workers(); i++)
       s += worker(i)->statistics();
     return s;
@@ -186,18 +258,22 @@ namespace Gecode { namespace Search { namespace Par {
   void
   BAB<Tracer>::constrain(const Space& b) {
     m_search.acquire();
+    Space* c = b.clone();
     if (best != NULL) {
-      best->constrain(b);
-      if (best->status() != SS_FAILED) {
+      /*
+       * The incumbent is shared with the workers and must not be
+       * modified, hence check whether b is better on a clone of b.
+       */
+      c->constrain(best->space());
+      if (c->status() == SS_FAILED) {
+        delete c;
         m_search.release();
         return;
       }
-      delete best;
+      delete c;
+      c = b.clone();
     }
-    best = b.clone();
-    // Announce better solutions
-    for (unsigned int i=0U; i<workers(); i++)
-      worker(i)->better(best);
+    better(new Incumbent(c));
     m_search.release();
   }
 
@@ -251,16 +327,17 @@ namespace Gecode { namespace Search { namespace Par {
       case C_WORK:
         // Perform exploration work
         {
-          m.acquire();
+          // Answer a pending steal request
+          serve();
+          // Take into account better solutions found by other workers
+          accept();
           if (idle) {
-            m.release();
             // Try to find new work
             find();
           } else if (cur != NULL) {
             start();
             if (stop(engine().opt())) {
               // Report stop
-              m.release();
               engine().stop();
             } else {
               node++;
@@ -287,7 +364,6 @@ namespace Gecode { namespace Search { namespace Par {
                 delete cur;
                 cur = NULL;
                 path.next();
-                m.release();
                 break;
               case SS_SOLVED:
                 {
@@ -302,7 +378,6 @@ namespace Gecode { namespace Search { namespace Par {
                   delete cur;
                   cur = NULL;
                   path.next();
-                  m.release();
                   engine().solution(s);
                 }
                 break;
@@ -323,7 +398,6 @@ namespace Gecode { namespace Search { namespace Par {
                     tracer.node(ei,ni);
                   }
                   cur->commit(*ch,0);
-                  m.release();
                 }
                 break;
               default:
@@ -331,14 +405,22 @@ namespace Gecode { namespace Search { namespace Par {
               }
             }
           } else if (!path.empty()) {
-            cur = path.recompute(d,engine().opt().a_d,*this,*best,mark,tracer);
+            cur = (best == NULL) ?
+              path.recompute(d,engine().opt().a_d,*this,tracer) :
+              path.recompute(d,engine().opt().a_d,*this,best->space(),mark,
+                             tracer);
             if (cur == NULL)
               path.next();
-            m.release();
+          } else if (Space* s = take()) {
+            // Continue with next subproblem, constrained by best solution
+            d = 0;
+            cur = s;
+            mark = 0;
+            if (best != NULL)
+              cur->constrain(best->space());
           } else {
             idle = true;
             path.ngdl(0);
-            m.release();
             // Report that worker is idle
             engine().idle();
           }
@@ -365,12 +447,19 @@ namespace Gecode { namespace Search { namespace Par {
     // Wait for reset cycle started
     e_reset_ack_start.wait();
     // All workers are marked as busy again
-    delete best;
+    Incumbent::release(best);
     best = NULL;
     n_busy = workers();
-    for (unsigned int i=1U; i<workers(); i++)
-      worker(i)->reset(NULL,0);
-    worker(0)->reset(s,opt().nogoods_limit);
+    if (eps()) {
+      discard();
+      for (unsigned int i=0U; i<workers(); i++)
+        worker(i)->reset(NULL,0);
+      decompose(s,false);
+    } else {
+      for (unsigned int i=1U; i<workers(); i++)
+        worker(i)->reset(NULL,0);
+      worker(0)->reset(s,opt().nogoods_limit);
+    }
     // Block workers again to ensure invariant
     block();
     // Release reset lock
@@ -409,13 +498,15 @@ namespace Gecode { namespace Search { namespace Par {
    */
   template<class Tracer>
   BAB<Tracer>::Worker::~Worker(void) {
-    delete best;
+    Incumbent::release(best);
+    Incumbent::release(_better);
   }
 
   template<class Tracer>
   BAB<Tracer>::~BAB(void) {
     terminate();
-    delete best;
+    discard();
+    Incumbent::release(best);
     heap.rfree(_worker);
   }
 
@@ -58,6 +58,10 @@ namespace Gecode { namespace Search { namespace Par {
     using Engine<Tracer>::solutions;
     using Engine<Tracer>::terminate;
     using Engine<Tracer>::workers;
+    using Engine<Tracer>::eps;
+    using Engine<Tracer>::decompose;
+    using Engine<Tracer>::discard;
+    using Engine<Tracer>::sp_stat;
     using Engine<Tracer>::C_WAIT;
     using Engine<Tracer>::C_RESET;
     using Engine<Tracer>::C_TERMINATE;
@@ -66,7 +70,6 @@ namespace Gecode { namespace Search { namespace Par {
     class Worker : public Engine<Tracer>::Worker {
     public:
       using Engine<Tracer>::Worker::_engine;
-      using Engine<Tracer>::Worker::m;
       using Engine<Tracer>::Worker::path;
       using Engine<Tracer>::Worker::cur;
       using Engine<Tracer>::Worker::d;
@@ -76,8 +79,16 @@ namespace Gecode { namespace Search { namespace Par {
       using Engine<Tracer>::Worker::start;
       using Engine<Tracer>::Worker::tracer;
       using Engine<Tracer>::Worker::stop;
-      /// Initialize for space \a s with engine \a e
-      Worker(Space* s, DFS& e);
+      using Engine<Tracer>::Worker::steal_attempt;
+      using Engine<Tracer>::Worker::steal_success;
+      using Engine<Tracer>::Worker::victims;
+      using Engine<Tracer>::Worker::n_victims;
+      using Engine<Tracer>::Worker::victim;
+      using Engine<Tracer>::Worker::serve;
+      using Engine<Tracer>::Worker::take;
+      using Engine<Tracer>::Worker::sp;
+      /// Initialize for space \a s with engine \a e as worker \a i
+      Worker(Space* s, DFS& e, unsigned int i);
       /// Provide access to engine
       DFS& engine(void) const;
       /// Start execution of worker
@@ -53,8 +53,8 @@ namespace Gecode { namespace Search { namespace Par {
    */
   template<class Tracer>
   forceinline
-  DFS<Tracer>::Worker::Worker(Space* s, DFS& e)
-    : Engine<Tracer>::Worker(s,e) {}
+  DFS<Tracer>::Worker::Worker(Space* s, DFS& e, unsigned int i)
+    : Engine<Tracer>::Worker(s,e,i) {}
   template<class Tracer>
   forceinline
   DFS<Tracer>::DFS(Space* s, const Options& o)
@@ -64,11 +64,18 @@ namespace Gecode { namespace Search { namespace Par {
     // Create workers
     _worker = static_cast<Worker**>
       (heap.ralloc(workers() * sizeof(Worker*)));
-    // The first worker gets the entire search tree
-    _worker[0] = new Worker(s,*this);
-    // All other workers start with no work
-    for (unsigned int i=1; i<workers(); i++)
-      _worker[i] = new Worker(NULL,*this);
+    if (eps()) {
+      // All workers take subproblems from the decomposed root
+      for (unsigned int i=0U; i<workers(); i++)
+        _worker[i] = new Worker(NULL,*this,i);
+      decompose(s,opt().clone);
+    } else {
+      // The first worker gets the entire search tree
+      _worker[0] = new Worker(s,*this,0U);
+      // All other workers start with no work
+      for (unsigned int i=1U; i<workers(); i++)
+        _worker[i] = new Worker(NULL,*this,i);
+    }
     // Block all workers
     block();
     // Create and start threads
@@ -88,6 +95,7 @@ namespace Gecode { namespace Search { namespace Par {
     path.reset((s != NULL) ? ngdl : 0);
     d = 0;
     idle = false;
+    sp = false;
     if ((s == NULL) || (s->status(*this) == SS_FAILED)) {
       delete s;
       cur = NULL;
@@ -121,12 +129,22 @@ namespace Gecode { namespace Search { namespace Par {
   forceinline void
   DFS<Tracer>::Worker::find(void) {
     // Try to find new work (even if there is none)
-    for (unsigned int i=0U; i<engine().workers(); i++) {
+    victims();
+    unsigned long int n_a = 0ul;
+    for (unsigned int i=0U; i<n_victims(); i++) {
       unsigned long int r_d = 0ul;
-      typename Engine<Tracer>::Worker* wi = engine().worker(i);
-      if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
+      typename Engine<Tracer>::Worker* wi = engine().worker(victim(i));
+      /*
+       * Make a quick check whether the worker might have work
+       *
+       * If that is not true any longer, the worker will be asked
+       * again eventually.
+       */
+      if (!wi->work())
+        continue;
+      n_a++;
+      if (Space* s = wi->steal(*this,r_d)) {
         // Reset this guy
-        m.acquire();
         idle = false;
         // Not idle but also does not have the root of the tree
         path.ngdl(0);
@@ -135,10 +153,12 @@ namespace Gecode { namespace Search { namespace Par {
         Statistics t = *this;
         Search::Worker::reset(r_d);
         (*this) += t;
-        m.release();
+        steal_attempt += n_a;
+        steal_success++;
         return;
       }
     }
+    steal_attempt += n_a;
   }
 
   /*
@@ -147,7 +167,7 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   Statistics
   DFS<Tracer>::statistics(void) const {
-    Statistics s;
+    Statistics s = sp_stat;
     for (unsigned int i=0U; i<workers(); i++)
       s += worker(i)->statistics();
     return s;
@@ -199,16 +219,15 @@ namespace Gecode { namespace Search { namespace Par {
       case C_WORK:
         // Perform exploration work
         {
-          m.acquire();
+          // Answer a pending steal request
+          serve();
           if (idle) {
-            m.release();
             // Try to find new work
             find();
           } else if (cur != NULL) {
             start();
             if (stop(engine().opt())) {
               // Report stop
-              m.release();
               engine().stop();
             } else {
               node++;
@@ -235,7 +254,6 @@ namespace Gecode { namespace Search { namespace Par {
                 delete cur;
                 cur = NULL;
                 path.next();
-                m.release();
                 break;
               case SS_SOLVED:
                 {
@@ -250,7 +268,6 @@ namespace Gecode { namespace Search { namespace Par {
                   delete cur;
                   cur = NULL;
                   path.next();
-                  m.release();
                   engine().solution(s);
                 }
                 break;
@@ -271,7 +288,6 @@ namespace Gecode { namespace Search { namespace Par {
                     tracer.node(ei,ni);
                   }
                   cur->commit(*ch,0);
-                  m.release();
                 }
                 break;
               default:
@@ -282,11 +298,13 @@ namespace Gecode { namespace Search { namespace Par {
             cur = path.recompute(d,engine().opt().a_d,*this,tracer);
             if (cur == NULL)
               path.next();
-            m.release();
+          } else if (Space* s = take()) {
+            // Continue with next subproblem
+            d = 0;
+            cur = s;
           } else {
             idle = true;
             path.ngdl(0);
-            m.release();
             // Report that worker is idle
             engine().idle();
           }
@@ -314,9 +332,16 @@ namespace Gecode { namespace Search { namespace Par {
     e_reset_ack_start.wait();
     // All workers are marked as busy again
     n_busy = workers();
-    for (unsigned int i=1U; i<workers(); i++)
-      worker(i)->reset(NULL,0);
-    worker(0U)->reset(s,opt().nogoods_limit);
+    if (eps()) {
+      discard();
+      for (unsigned int i=0U; i<workers(); i++)
+        worker(i)->reset(NULL,0);
+      decompose(s,false);
+    } else {
+      for (unsigned int i=1U; i<workers(); i++)
+        worker(i)->reset(NULL,0);
+      worker(0U)->reset(s,opt().nogoods_limit);
+    }
     // Block workers again to ensure invariant
     block();
     // Release reset lock
@@ -358,6 +383,7 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   DFS<Tracer>::~DFS(void) {
     terminate();
+    discard();
     heap.rfree(_worker);
   }
 
@@ -34,6 +34,8 @@
 #ifndef __GECODE_SEARCH_PAR_ENGINE_HH__
 #define __GECODE_SEARCH_PAR_ENGINE_HH__
 
+#include <atomic>
+
 #include <gecode/search.hh>
 #include <gecode/search/support.hh>
 #include <gecode/search/worker.hh>
@@ -41,7 +43,17 @@
 
 namespace Gecode { namespace Search { namespace Par {
 
-  /// %Parallel depth-first search engine
+  /**
+   * \brief %Parallel depth-first search engine
+   *
+   * The path of a worker is only ever accessed by the thread running
+   * the worker. A worker that runs out of work (a thief) posts a steal
+   * request to another worker (the victim) and waits for an answer.
+   * The victim answers pending requests between exploring two nodes.
+   * Hence, a busy worker never acquires a lock for exploration and
+   * only thieves pay for synchronization.
+   *
+   */
   template<class Tracer>
   class Engine : public Search::Engine, public Support::Terminator {
   protected:
@@ -53,8 +65,6 @@ namespace Gecode { namespace Search { namespace Par {
     protected:
       /// Reference to engine
       Engine& _engine;
-      /// Mutex for access to worker
-      Support::Mutex m;
       /// Current path ins search tree
       Path<Tracer> path;
       /// Current space being explored
@@ -63,13 +73,45 @@ namespace Gecode { namespace Search { namespace Par {
       unsigned int d;
       /// Whether the worker is idle
       bool idle;
+      /// Index of worker
+      unsigned int _index;
+      /// Order in which other workers are tried for stealing
+      unsigned int* _victim;
+      /// Random number generator for victim selection
+      Support::RandomGenerator rnd;
+      /// Compute order in which other workers are tried for stealing
+      void victims(void);
+      /// Return number of victims
+      unsigned int n_victims(void) const;
+      /// Return the \a i-th victim
+      unsigned int victim(unsigned int i) const;
+      /// Thief waiting for an answer to its steal request (NULL if none)
+      std::atomic<Worker*> _thief;
+      /// Whether the steal request of this worker has been answered
+      std::atomic<bool> _answered;
+      /// Space handed over as answer to a steal request (NULL if none)
+      Space* _stolen;
+      /// Depth of the space handed over
+      unsigned long int _stolen_d;
+      /// Answer a pending steal request (only called by the worker itself)
+      void serve(void);
+      /// Whether the worker explores a subproblem taken from the engine
+      bool sp;
+      /// Number of nodes when the current subproblem has been taken
+      unsigned long int sp_node;
+      /// Take next subproblem from the engine (NULL if none is left)
+      Space* take(void);
     public:
-      /// Initialize for space \a s with engine \a e
-      Worker(Space* s, Engine& e);
-      /// Hand over some work (NULL if no work available)
-      Space* steal(unsigned long int& d, Tracer& myt, Tracer& ot);
-      /// Return statistics
-      Statistics statistics(void);
+      /// Initialize for space \a s with engine \a e as worker \a i
+      Worker(Space* s, Engine& e, unsigned int i);
+      /// Return index of worker
+      unsigned int index(void) const;
+      /// Make a quick check whether work can be stolen from this worker
+      bool work(void) const;
+      /// Request some work for thief \a t (NULL if no work available)
+      Space* steal(Worker& t, unsigned long int& d);
+      /// Return statistics (read without synchronization)
+      Statistics statistics(void) const;
       /// Provide access to engine
       Engine& engine(void) const;
       /// Return no-goods
@@ -86,6 +128,8 @@ namespace Gecode { namespace Search { namespace Par {
     const Options& opt(void) const;
     /// Return number of workers
     unsigned int workers(void) const;
+    /// Provide access to worker \a i
+    virtual Worker* worker(unsigned int i) const = 0;
 
     /// \name Commands from engine to workers and wait management
     //@{
@@ -184,6 +228,36 @@ namespace Gecode { namespace Search { namespace Par {
     void stop(void);
     //@}
 
+    /// \name Decomposition into subproblems
+    //@{
+  protected:
+    /// Mutex for taking subproblems
+    Support::Mutex m_sp;
+    /// Root space from which subproblems are replayed (NULL if none)
+    Space* sp_root;
+    /// Paths to the subproblems
+    ChoicePath** sp_path;
+    /// Number of subproblems
+    unsigned int sp_n;
+    /// Index of next subproblem to be taken
+    unsigned int sp_next;
+    /// Statistics for decomposition
+    Statistics sp_stat;
+    /// Whether the root is decomposed into subproblems
+    bool eps(void) const;
+    /**
+     * \brief Decompose \a s into subproblems
+     *
+     * Unless \a c is true, the space \a s is owned by the engine.
+     */
+    void decompose(Space* s, bool c);
+    /// Delete all subproblems not taken yet
+    void discard(void);
+  public:
+    /// Return next subproblem (NULL if none is left)
+    Space* subproblem(void);
+    //@}
+
     /// \name Engine interface
     //@{
     /// Initialize with options \a o
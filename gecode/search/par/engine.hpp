@@ -92,11 +92,20 @@ namespace Gecode { namespace Search { namespace Par {
    */
   template<class Tracer>
   forceinline
-  Engine<Tracer>::Worker::Worker(Space* s, Engine& e)
+  Engine<Tracer>::Worker::Worker(Space* s, Engine& e, unsigned int i)
     : tracer(e.opt().tracer), _engine(e),
       path(s == NULL ? 0 : e.opt().nogoods_limit), d(0),
-      idle(false) {
+      idle(false), _index(i), rnd(i+1U),
+      _thief(NULL), _answered(false), _stolen(NULL), _stolen_d(0UL),
+      sp(false), sp_node(0UL) {
     tracer.worker();
+    // Initialize victims: all other workers, starting after this worker
+    _victim = heap.alloc<unsigned int>(n_victims());
+    for (unsigned int j=0U; j<n_victims(); j++)
+      _victim[j] = (i+j+1U) % e.workers();
+    if (e.opt().steal == STEAL_LINEAR)
+      for (unsigned int j=0U; j<n_victims(); j++)
+        _victim[j] = (j < i) ? j : j+1U;
     if (s != NULL) {
       if (s->status(*this) == SS_FAILED) {
         fail++;
@@ -114,7 +123,8 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   forceinline
   Engine<Tracer>::Engine(const Options& o)
-    : _opt(o), solutions(heap) {
+    : _opt(o), solutions(heap),
+      sp_root(NULL), sp_path(NULL), sp_n(0U), sp_next(0U) {
     // Initialize termination information
     _n_term_not_ack = workers();
     _n_not_terminated = workers();
@@ -131,11 +141,13 @@ namespace Gecode { namespace Search { namespace Par {
    */
   template<class Tracer>
   forceinline Statistics
-  Engine<Tracer>::Worker::statistics(void) {
-    m.acquire();
-    Statistics s = *this;
-    m.release();
-    return s;
+  Engine<Tracer>::Worker::statistics(void) const {
+    /*
+     * The statistics are only written by the worker itself and are
+     * read here without synchronization. Hence, they might be slightly
+     * outdated while the worker is still busy.
+     */
+    return *this;
   }
 
 
@@ -179,6 +191,128 @@ namespace Gecode { namespace Search { namespace Par {
   }
 
 
+  /*
+   * Engine: decomposition into subproblems
+   */
+  template<class Tracer>
+  forceinline bool
+  Engine<Tracer>::eps(void) const {
+    return (opt().subproblems > 0U) && (opt().tracer == NULL);
+  }
+
+  template<class Tracer>
+  void
+  Engine<Tracer>::decompose(Space* s, bool c) {
+    sp_stat.reset();
+    if (s == NULL)
+      return;
+    if (s->status(sp_stat) == SS_FAILED) {
+      sp_stat.fail++;
+      if (!c)
+        delete s;
+      return;
+    }
+    sp_root = c ? s->clone() : s;
+    /*
+     * Split the nodes of the current level from left to right into
+     * their alternatives. Splitting stops in the middle of a level as
+     * soon as the number of nodes is large enough. Failed alternatives
+     * are rejected, solved nodes are kept as subproblems.
+     */
+    Support::DynamicArray<Space*,Heap> ls(heap);
+    Support::DynamicArray<ChoicePath*,Heap> lp(heap);
+    int n = 1;
+    ls[0] = sp_root->clone(); lp[0] = new ChoicePath;
+    int m = static_cast<int>(opt().subproblems);
+    bool branch = (ls[0]->status() == SS_BRANCH);
+    while (branch && (n < m)) {
+      branch = false;
+      Support::DynamicArray<Space*,Heap> ns(heap);
+      Support::DynamicArray<ChoicePath*,Heap> np(heap);
+      int k = 0;
+      for (int i=0; i<n; i++) {
+        if ((k + n - i >= m) || (ls[i]->status() != SS_BRANCH)) {
+          ns[k] = ls[i]; np[k] = lp[i]; k++;
+          continue;
+        }
+        const Choice* ch = ls[i]->choice();
+        unsigned int a = ch->alternatives();
+        for (unsigned int j=0U; j<a; j++) {
+          Space* t = (j+1U < a) ? ls[i]->clone() : ls[i];
+          t->commit(*ch,j);
+          sp_stat.node++;
+          switch (t->status(sp_stat)) {
+          case SS_FAILED:
+            sp_stat.fail++;
+            delete t;
+            continue;
+          case SS_BRANCH:
+            branch = true;
+            break;
+          default:
+            break;
+          }
+          ns[k] = t; np[k] = new ChoicePath(*lp[i]); np[k]->push(*ch,j); k++;
+        }
+        delete ch;
+        delete lp[i];
+      }
+      for (int i=0; i<k; i++) {
+        ls[i] = ns[i]; lp[i] = np[i];
+      }
+      n = k;
+      sp_stat.depth++;
+    }
+    sp_path = heap.alloc<ChoicePath*>(n);
+    for (int i=0; i<n; i++) {
+      delete ls[i]; sp_path[i] = lp[i];
+    }
+    sp_n = static_cast<unsigned int>(n);
+    sp_next = 0U;
+  }
+
+  template<class Tracer>
+  void
+  Engine<Tracer>::discard(void) {
+    for (unsigned int i=sp_next; i<sp_n; i++)
+      delete sp_path[i];
+    heap.free<ChoicePath*>(sp_path,sp_n);
+    sp_path = NULL;
+    sp_n = sp_next = 0U;
+    delete sp_root;
+    sp_root = NULL;
+  }
+
+  template<class Tracer>
+  Space*
+  Engine<Tracer>::subproblem(void) {
+    Space* s = NULL;
+    // Cloning the root is not thread-safe
+    m_sp.acquire();
+    if (sp_next < sp_n) {
+      ChoicePath* p = sp_path[sp_next++];
+      s = p->replay(*sp_root);
+      delete p;
+    }
+    m_sp.release();
+    return s;
+  }
+
+  template<class Tracer>
+  forceinline Space*
+  Engine<Tracer>::Worker::take(void) {
+    if (sp)
+      subproblem_node = std::max(subproblem_node, node - sp_node);
+    Space* s = engine().subproblem();
+    sp = (s != NULL);
+    if (sp) {
+      subproblem++;
+      sp_node = node;
+    }
+    return s;
+  }
+
+
   /*
    * Engine: termination control
    */
@@ -257,28 +391,116 @@ namespace Gecode { namespace Search { namespace Par {
 
 
 
+  /*
+   * Worker: victim selection
+   */
+  template<class Tracer>
+  forceinline unsigned int
+  Engine<Tracer>::Worker::index(void) const {
+    return _index;
+  }
+  template<class Tracer>
+  forceinline unsigned int
+  Engine<Tracer>::Worker::n_victims(void) const {
+    return engine().workers() - 1U;
+  }
+  template<class Tracer>
+  forceinline unsigned int
+  Engine<Tracer>::Worker::victim(unsigned int i) const {
+    assert(i < n_victims());
+    return _victim[i];
+  }
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::victims(void) {
+    unsigned int n = n_victims();
+    switch (engine().opt().steal) {
+    case STEAL_LINEAR:
+    case STEAL_ROUNDROBIN:
+      // The order is fixed and has been computed initially
+      break;
+    case STEAL_RANDOM:
+      // Random permutation of the previous order
+      for (unsigned int i=n; i>1U; i--)
+        std::swap(_victim[i-1U],_victim[rnd(i)]);
+      break;
+    case STEAL_RICHEST:
+      {
+        /*
+         * Sort by decreasing amount of work. The amount of work is read
+         * without synchronization, so it is only an estimate.
+         */
+        for (unsigned int i=1U; i<n; i++) {
+          unsigned int v = _victim[i];
+          unsigned int w = engine().worker(v)->path.work();
+          unsigned int j = i;
+          for (; (j > 0U) &&
+                 (engine().worker(_victim[j-1U])->path.work() < w); j--)
+            _victim[j] = _victim[j-1U];
+          _victim[j] = v;
+        }
+      }
+      break;
+    default: GECODE_NEVER;
+    }
+  }
+
+
   /*
    * Worker: finding and stealing working
    */
   template<class Tracer>
-  forceinline Space*
-  Engine<Tracer>::Worker::steal(unsigned long int& d, 
-                                Tracer& myt, Tracer& ot) {
-    /*
-     * Make a quick check whether the worker might have work
-     *
-     * If that is not true any longer, the worker will be asked
-     * again eventually.
-     */
-    if (!path.steal())
-      return NULL;
-    m.acquire();
-    Space* s = path.steal(*this,d,myt,ot);
-    m.release();
+  forceinline bool
+  Engine<Tracer>::Worker::work(void) const {
+    return path.steal();
+  }
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::serve(void) {
+    // Quick check whether there is any request at all
+    if (_thief.load(std::memory_order_relaxed) == NULL)
+      return;
+    // The request might have been withdrawn in the meantime
+    Worker* t = _thief.exchange(NULL,std::memory_order_acq_rel);
+    if (t == NULL)
+      return;
+    unsigned long int d = 0UL;
+    Space* s = path.steal() ? path.steal(*this,d,tracer,t->tracer) : NULL;
     // Tell that there will be one more busy worker
     if (s != NULL)
       engine().busy();
-    return s;
+    t->_stolen = s;
+    t->_stolen_d = d;
+    t->_answered.store(true,std::memory_order_release);
+  }
+
+  template<class Tracer>
+  forceinline Space*
+  Engine<Tracer>::Worker::steal(Worker& t, unsigned long int& d) {
+    t._answered.store(false,std::memory_order_relaxed);
+    // Only a single thief can wait for an answer
+    Worker* n = NULL;
+    if (!_thief.compare_exchange_strong(n,&t,std::memory_order_acq_rel))
+      return NULL;
+    unsigned int w = 0U;
+    while (!t._answered.load(std::memory_order_acquire)) {
+      // The thief itself has no work to hand over
+      t.serve();
+      /*
+       * Withdraw the request if the victim takes too long to answer
+       * or if the workers must stop. If withdrawing fails, the victim
+       * has already taken the request and is about to answer.
+       */
+      if ((++w > Config::steal_wait) || (engine().cmd() != C_WORK)) {
+        Worker* r = &t;
+        if (_thief.compare_exchange_strong(r,NULL,
+                                           std::memory_order_acq_rel))
+          return NULL;
+      }
+      Support::Thread::yield();
+    }
+    d = t._stolen_d;
+    return t._stolen;
   }
 
   /*
@@ -356,6 +578,7 @@ namespace Gecode { namespace Search { namespace Par {
    */
   template<class Tracer>
   Engine<Tracer>::Worker::~Worker(void) {
+    heap.free<unsigned int>(_victim,n_victims());
     delete cur;
     path.reset(0);
     tracer.done();
@@ -149,6 +149,8 @@ namespace Gecode { namespace Search { namespace Par {
     int entries(void) const;
     /// Reset stack and set no-good depth limit to \a l
     void reset(unsigned int l);
+    /// Return number of edges that have work for stealing
+    unsigned int work(void) const;
     /// Make a quick check whether stealing might be feasible
     bool steal(void) const;
     /// Steal work at depth \a d
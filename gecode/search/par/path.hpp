@@ -241,6 +241,12 @@ namespace Gecode { namespace Search { namespace Par {
     _ngdl = l;
   }
 
+  template<class Tracer>
+  forceinline unsigned int
+  Path<Tracer>::work(void) const {
+    return n_work;
+  }
+
   template<class Tracer>
   forceinline bool
   Path<Tracer>::steal(void) const {
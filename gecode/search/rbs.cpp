@@ -50,4 +50,55 @@ namespace Gecode { namespace Search { namespace Seq {
 
 }}}
 
+#ifdef GECODE_HAS_THREADS
+
+#include <gecode/search/par/pbs.hh>
+
+namespace Gecode { namespace Search { namespace Par {
+
+  Stop*
+  rbsstop(Stop* so) {
+    return new Seq::RestartStop(new PortfolioStop(so));
+  }
+
+  /// Parallel restart engine owning the store for sharing no-goods
+  class RBSPortfolio : public PBS<CollectBest> {
+  protected:
+    /// The store (possibly NULL)
+    NoGoodStore* ngs;
+  public:
+    /// Initialize
+    RBSPortfolio(Engine** e, Stop** s, unsigned int n,
+                 const Statistics& stat, NoGoodStore* ngs0)
+      : PBS<CollectBest>(e,s,n,stat), ngs(ngs0) {}
+    /// Destructor
+    virtual ~RBSPortfolio(void) {
+      delete ngs;
+    }
+  };
+
+  Engine*
+  rbsengine(Space** masters, Stop** stops, Engine** slaves, Cutoff** co,
+            unsigned int n, const Search::Statistics& stat,
+            const Options& opt) {
+    Region r;
+    Engine** rbs = r.alloc<Engine*>(n);
+    Stop** pss = r.alloc<Stop*>(n);
+    NoGoodStore* ngs = ((opt.nogoods_limit > 0U) && (opt.nogoods_share > 0U))
+      ? new NoGoodStore(opt.nogoods_share) : NULL;
+    for (unsigned int i=0U; i<n; i++) {
+      Options o(opt);
+      o.cutoff = co[i];
+      Seq::RestartStop* rs = static_cast<Seq::RestartStop*>(stops[i]);
+      SharedNoGoods* sng = (ngs != NULL) ? new SharedNoGoods(*ngs,i) : NULL;
+      rbs[i] = new Seq::RBS(masters[i],rs,slaves[i],Statistics(),o,true,sng);
+      pss[i] = rs->metastop();
+    }
+    return new RBSPortfolio(rbs,pss,n,stat,ngs);
+  }
+
+}}}
+
+#endif
+
 // STATISTICS: search-seq
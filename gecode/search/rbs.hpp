@@ -50,6 +50,75 @@ namespace Gecode { namespace Search { namespace Seq {
 
 }}}
 
+#ifdef GECODE_HAS_THREADS
+
+namespace Gecode { namespace Search { namespace Par {
+
+  /// Create stop object for a worker of a parallel restart engine
+  GECODE_SEARCH_EXPORT Stop*
+  rbsstop(Stop* so);
+
+  /**
+   * \brief Create parallel restart engine
+   *
+   * Worker \a i restarts from master space \a masters[i], explores with
+   * engine \a slaves[i] (created with stop object \a stops[i]), and uses
+   * the cutoff sequence \a co[i].
+   */
+  GECODE_SEARCH_EXPORT Engine*
+  rbsengine(Space** masters, Stop** stops, Engine** slaves, Cutoff** co,
+            unsigned int n, const Search::Statistics& stat,
+            const Options& opt);
+
+}}}
+
+namespace Gecode { namespace Search { namespace Meta {
+
+  /**
+   * \brief Create parallel restart engine for best solution search
+   *
+   * Each worker restarts on its own, following its own copy of the
+   * cutoff sequence. The copy for worker \a i starts \a i steps ahead. Returns NULL if the cutoff sequence cannot be
+   * copied.
+   */
+  template<class T, template<class> class E>
+  Engine*
+  rbspar(Space* master, const Search::Statistics& stat,
+         const Options& m_opt, const Options& e_opt) {
+    Region r;
+    unsigned int n = static_cast<unsigned int>(e_opt.threads);
+    Cutoff** co = r.alloc<Cutoff*>(n);
+    co[0] = m_opt.cutoff;
+    for (unsigned int i=1U; i<n; i++)
+      if ((co[i] = m_opt.cutoff->copy(i)) == NULL) {
+        for (unsigned int j=1U; j<i; j++)
+          delete co[j];
+        return NULL;
+      }
+    // Stagger the sequences so that workers do not restart in lockstep
+    for (unsigned int i=1U; i<n; i++)
+      for (unsigned int j=0U; j<i; j++)
+        (void) ++(*co[i]);
+    Space** masters = r.alloc<Space*>(n);
+    Stop** stops = r.alloc<Stop*>(n);
+    Engine** slaves = r.alloc<Engine*>(n);
+    Options w_opt(e_opt);
+    w_opt.threads = 1.0;
+    for (unsigned int i=0U; i<n; i++) {
+      masters[i] = (i == n-1U) ? master : master->clone();
+      w_opt.stop = stops[i] = Par::rbsstop(m_opt.stop);
+      Space* slave = masters[i]->clone();
+      MetaInfo mi(0,0,0,NULL,NoGoods::eng);
+      slave->slave(mi);
+      slaves[i] = build<T,E>(slave,w_opt);
+    }
+    return Par::rbsengine(masters,stops,slaves,co,n,stat,m_opt);
+  }
+
+}}}
+
+#endif
+
 namespace Gecode { namespace Search {
 
   /// A RBS engine builder
@@ -96,6 +165,20 @@ namespace Gecode {
       e = Search::Seq::dead(e_opt, stat);
     } else {
       Space* master = m_opt.clone ? s->clone() : s;
+#ifdef GECODE_HAS_THREADS
+      /*
+       * For best solution search with several threads, each worker
+       * restarts on its own. This requires that the cutoff sequence
+       * can be copied, otherwise all threads restart together.
+       */
+      if (E<T>::best && (e_opt.threads > 1.0) && (e_opt.tracer == NULL)) {
+        e = Search::Meta::rbspar<T,E>(master,stat,m_opt,e_opt);
+        if (e != NULL) {
+          delete e_opt.stop;
+          return;
+        }
+      }
+#endif
       Space* slave  = master->clone();
       MetaInfo mi(0,0,0,NULL,NoGoods::eng);
       slave->slave(mi);
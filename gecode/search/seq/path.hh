@@ -145,6 +145,8 @@ namespace Gecode { namespace Search { namespace Seq {
     void reset(void);
     /// Post no-goods
     virtual void post(Space& home) const;
+    /// Archive no-goods into \a e and return their depth
+    virtual unsigned int archive(Archive& e) const;
   };
 
 }}}
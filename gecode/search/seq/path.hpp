@@ -386,6 +386,23 @@ namespace Gecode { namespace Search { namespace Seq {
     GECODE_ES_FAIL(NoGoodsProp::post(home,*this));
   }
 
+  template<class Tracer>
+  unsigned int
+  Path<Tracer>::archive(Archive& e) const {
+    int n = std::min(ds.entries(),static_cast<int>(ngdl()));
+    // Eliminate the alternatives which are not no-goods at the end
+    while ((n > 0) && (ds[n-1].truealt() == 0U))
+      n--;
+    if (n == 0)
+      return 0U;
+    e << n;
+    for (int i=0; i<n; i++) {
+      e << ds[i].truealt() << ds[i].rightmost();
+      ds[i].choice()->archive(e);
+    }
+    return static_cast<unsigned int>(n);
+  }
+
 }}}
 
 // STATISTICS: search-seq
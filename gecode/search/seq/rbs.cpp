@@ -52,17 +52,30 @@ namespace Gecode { namespace Search { namespace Seq {
     return false;
   }
 
+  NoGoods&
+  RBS::nogoods(void) {
+    NoGoods& ng = e->nogoods();
+    if (sng == NULL)
+      return ng;
+    if (sng->put(ng))
+      stop->m_stat.nogood_export++;
+    return *sng;
+  }
+
   Space*
   RBS::next(void) {
     if (restart) {
       restart = false;
       sslr++;
-      NoGoods& ng = e->nogoods();
+      NoGoods& ng = nogoods();
       // Reset number of no-goods found
       ng.ng(0);
-      MetaInfo mi(stop->m_stat.restart,sslr,e->statistics().fail,last,ng);
+      MetaInfo mi(stop->m_stat.restart,sslr,e->statistics().fail,last,ng,
+                    rp);
       bool r = master->master(mi);
       stop->m_stat.nogood += ng.ng();
+      if (sng != NULL)
+        sng->update(stop->m_stat);
       if (master->status(stop->m_stat) == SS_FAILED) {
         stop->update(e->statistics());
         delete master;
@@ -91,12 +104,17 @@ namespace Gecode { namespace Search { namespace Seq {
                   (e->stopped() && stop->enginestopped()) ) {
         // The engine must perform a true restart
         // The number of the restart has been incremented in the stop object
+        if (sslr == 0)
+          adapt(e->stopped());
         sslr = 0;
-        NoGoods& ng = e->nogoods();
+        NoGoods& ng = nogoods();
         ng.ng(0);
-        MetaInfo mi(stop->m_stat.restart,sslr,e->statistics().fail,last,ng);
+        MetaInfo mi(stop->m_stat.restart,sslr,e->statistics().fail,last,ng,
+                    rp);
         (void) master->master(mi);
         stop->m_stat.nogood += ng.ng();
+        if (sng != NULL)
+          sng->update(stop->m_stat);
         long unsigned int nl = ++(*co);
         stop->limit(e->statistics(),nl);
         if (master->status(stop->m_stat) == SS_FAILED)
@@ -133,6 +151,8 @@ namespace Gecode { namespace Search { namespace Seq {
     last = b.clone();
     master->constrain(b);
     e->constrain(b);
+    // Continue from the new solution as if it had been found here
+    restart = true;
   }
 
   bool
@@ -153,6 +173,7 @@ namespace Gecode { namespace Search { namespace Seq {
     delete last;
     delete co;
     delete stop;
+    delete sng;
   }
 
 }}}
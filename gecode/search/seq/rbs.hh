@@ -35,6 +35,7 @@
 #define __GECODE_SEARCH_SEQ_RBS_HH__
 
 #include <gecode/search.hh>
+#include <gecode/search/nogoods.hh>
 
 namespace Gecode { namespace Search { namespace Seq {
 
@@ -66,6 +67,8 @@ namespace Gecode { namespace Search { namespace Seq {
     bool enginestopped(void) const;
     /// Return statistics for the meta engine
     Statistics metastatistics(void) const;
+    /// Return stop object for the meta engine
+    Stop* metastop(void) const;
   };
 
   /// Engine for restart-based search
@@ -91,10 +94,19 @@ namespace Gecode { namespace Search { namespace Seq {
     bool restart;
     /// Whether the engine performs best solution search
     bool best;
+    /// Current relaxation probability (0.0 if not adapted)
+    double rp;
+    /// Adapt relaxation probability after a neighbourhood without solution
+    void adapt(bool stopped);
+    /// No-goods shared with other engines (possibly NULL)
+    SharedNoGoods* sng;
+    /// Return no-goods for restart (after sharing them if needed)
+    NoGoods& nogoods(void);
   public:
     /// Constructor
     RBS(Space* s, RestartStop* stop0, Engine* e0,
-        const Search::Statistics& stat, const Options& o, bool best);
+        const Search::Statistics& stat, const Options& o, bool best,
+        SharedNoGoods* sng=NULL);
     /// Return next solution (NULL, if none exists or search has been stopped)
     virtual Space* next(void);
     /// Return statistics
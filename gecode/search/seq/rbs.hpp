@@ -60,17 +60,35 @@ namespace Gecode { namespace Search { namespace Seq {
     return m_stat;
   }
 
+  forceinline Stop*
+  RestartStop::metastop(void) const {
+    return m_stop;
+  }
+
 
   forceinline
   RBS::RBS(Space* s, RestartStop* stop0,
            Engine* e0, const Search::Statistics& stat, const Options& opt,
-           bool best0)
+           bool best0, SharedNoGoods* sng0)
     : e(e0), master(s), last(NULL), co(opt.cutoff), stop(stop0),
       sslr(0),
-      complete(true), restart(false), best(best0) {
+      complete(true), restart(false), best(best0), rp(opt.relax),
+      sng(sng0) {
     stop->limit(stat,(*co)());
   }
 
+  forceinline void
+  RBS::adapt(bool stopped) {
+    if (rp > 0.0) {
+      if (stopped)
+        // The cutoff was reached: the neighbourhood is too large
+        rp = std::max(0.01, 0.9 * rp);
+      else
+        // The neighbourhood has been exhausted: it is too small
+        rp = std::min(0.99, rp + 0.1 * (1.0 - rp));
+    }
+  }
+
 }}}
 
 // STATISTICS: search-seq
@@ -39,12 +39,18 @@ namespace Gecode { namespace Search {
   Statistics::reset(void) {
     StatusStatistics::reset();
     fail=0; node=0; depth=0; restart=0; nogood=0;
+    nogood_export=0; nogood_import=0; nogood_shared=0;
+    steal_attempt=0; steal_success=0;
+    subproblem=0; subproblem_node=0;
   }
 
   forceinline
   Statistics::Statistics(void)
     : fail(0), node(0), depth(0),
-      restart(0), nogood(0) {}
+      restart(0), nogood(0),
+      nogood_export(0), nogood_import(0), nogood_shared(0),
+      steal_attempt(0), steal_success(0),
+      subproblem(0), subproblem_node(0) {}
 
   forceinline Statistics&
   Statistics::operator +=(const Statistics& s) {
@@ -54,6 +60,13 @@ namespace Gecode { namespace Search {
     depth = std::max(depth,s.depth);
     restart += s.restart;
     nogood += s.nogood;
+    nogood_export += s.nogood_export;
+    nogood_import += s.nogood_import;
+    nogood_shared += s.nogood_shared;
+    steal_attempt += s.steal_attempt;
+    steal_success += s.steal_success;
+    subproblem += s.subproblem;
+    subproblem_node = std::max(subproblem_node,s.subproblem_node);
     return *this;
   }
 
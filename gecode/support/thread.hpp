@@ -334,6 +334,8 @@ namespace Gecode { namespace Support {
     static void run(Runnable* r);
     /// Put current thread to sleep for \a ms milliseconds
     static void sleep(unsigned int ms);
+    /// Let other threads run before continuing with the current thread
+    static void yield(void);
     /// Return number of processing units (1 if information not available)
     static unsigned int npu(void);
   private:
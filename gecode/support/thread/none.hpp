@@ -72,6 +72,8 @@ namespace Gecode { namespace Support {
   }
   forceinline void
   Thread::sleep(unsigned int) {}
+  forceinline void
+  Thread::yield(void) {}
   forceinline unsigned int
   Thread::npu(void) {
     return 1;
@@ -35,6 +35,8 @@
 #include <unistd.h>
 #endif
 
+#include <sched.h>
+
 #include <exception>
 
 namespace Gecode { namespace Support {
@@ -212,6 +214,10 @@ namespace Gecode { namespace Support {
     usleep(ms * 1000);
 #endif
   }
+  forceinline void
+  Thread::yield(void) {
+    (void) sched_yield();
+  }
   forceinline unsigned int
   Thread::npu(void) {
 #ifdef GECODE_HAS_UNISTD_H
@@ -95,6 +95,10 @@ namespace Gecode { namespace Support {
   Thread::sleep(unsigned int ms) {
     Sleep(static_cast<DWORD>(ms));
   }
+  forceinline void
+  Thread::yield(void) {
+    (void) SwitchToThread();
+  }
 
   forceinline unsigned int
   Thread::npu(void) {
@@ -154,20 +154,33 @@ namespace Test { namespace Int {
      };
      Gecode::IntSet d(r,4);
 
+     /// Domain wider than a word for variables
+     const int rwx[6][2] = {
+       {-71,-70},{-4,-2},{0,1},{3,3},{5,6},{70,71}
+     };
+     /// Domain wider than a word for constraint
+     const int rw[6][2] = {
+       {-70,-70},{-4,-3},{-1,-1},{1,1},{3,5},{70,70}
+     };
+
      /// %Test for domain constraint (full integer set)
      class DomDom : public Test {
+     protected:
+       /// Domain for constraint
+       Gecode::IntSet d;
      public:
        /// Create and register test
        DomDom(int n)
          : Test("Dom::Dom::"+str(n),n,-6,6,n == 1,
-                Gecode::IPL_DOM) {}
+                Gecode::IPL_DOM), d(Dom::d) {}
+       /// Create and register test with domains wider than a word
+       DomDom(const std::string& s, int n)
+         : Test("Dom::Dom::"+s+"::"+str(n),n,Gecode::IntSet(rwx,6),n == 1,
+                Gecode::IPL_DOM), d(rw,6) {}
        /// %Test whether \a x is solution
        virtual bool solution(const Assignment& x) const {
          for (int i=x.size(); i--; )
-           if (!(((x[i] >= -4) && (x[i] <= -3)) ||
-                 ((x[i] >= -1) && (x[i] <= -1)) ||
-                 ((x[i] >=  1) && (x[i] <=  1)) ||
-                 ((x[i] >=  3) && (x[i] <=  5))))
+           if (!d.in(x[i]))
              return false;
          return true;
        }
@@ -204,6 +217,8 @@ namespace Test { namespace Int {
      DomRange dr3(3);
      DomDom dd1(1);
      DomDom dd3(3);
+     DomDom ddw1("Wide",1);
+     DomDom ddw3("Wide",3);
      DomRangeEmpty dre;
      //@}
 
@@ -39,6 +39,7 @@
 
 #include <gecode/minimodel.hh>
 #include <climits>
+#include <cstdio>
 
 namespace Test { namespace Int {
 
@@ -656,6 +657,37 @@ namespace Test { namespace Int {
        return t;
      }
      
+     /// Return tuple set \a ts after saving to and loading from a file
+     Gecode::TupleSet persistent(const Gecode::TupleSet& ts) {
+       using namespace Gecode;
+       const char* fn = "gecode-test-tupleset.tmp";
+       ts.save(fn);
+       TupleSet t(fn);
+       (void) std::remove(fn);
+       if ((t != ts) || (t.arity() != ts.arity()) ||
+           (t.min() != ts.min()) || (t.max() != ts.max()))
+         throw Gecode::Int::InvalidTupleSetFile("Test::Int::"
+                                                "Extensional::persistent");
+       return t;
+     }
+
+     /// Return interned tuple set for an equal copy of \a ts
+     Gecode::TupleSet interned(const Gecode::TupleSet& ts) {
+       using namespace Gecode;
+       TupleSet t(ts.arity());
+       for (int i=0; i<ts.tuples(); i++)
+         t.add(IntArgs(ts.arity(),ts[i]));
+       t.finalize();
+       TupleSet s = intern(ts);
+       InternStatistics is = intern_statistics();
+       TupleSet u = intern(t);
+       if ((u != ts) || (intern_statistics().hits != is.hits+1) ||
+           (intern_statistics().bytes != is.bytes+t.bytes()))
+         throw Gecode::Exception("Test::Int::Extensional::interned",
+                                 "Tuple set not shared");
+       return u;
+     }
+
      /// Help class to create and register tests
      class Create {
      public:
@@ -672,11 +704,17 @@ namespace Test { namespace Int {
                .add({1, 5, 2, 5}).add({5, 3, 3, 2})
                .finalize();
              (void) new TupleSetTest("A",pos,IntSet(0,6),ts,true);
+             (void) new TupleSetTest("File::A",pos,IntSet(0,6),
+                                     persistent(ts),false);
+             (void) new TupleSetTest("Intern::A",pos,IntSet(0,6),
+                                     interned(ts),false);
            }
            {
              TupleSet ts(4);
              ts.finalize();
              (void) new TupleSetTest("Empty",pos,IntSet(1,2),ts,true);
+             (void) new TupleSetTest("File::Empty",pos,IntSet(1,2),
+                                     persistent(ts),false);
            }
            {
              TupleSet ts(4);
@@ -734,6 +772,9 @@ namespace Test { namespace Int {
            {
              for (int i = 0; i <= 64*6; i+=32)
                (void) new TupleSetTestSize(i,pos);
+             // Large enough for vectorized bit-set operations
+             for (int i = 64*12; i <= 64*20; i+=64*4)
+               (void) new TupleSetTestSize(i+17,pos);
            }
            {
              (void) new RandomTupleSetTest("Rand(10,-1,2)", pos,
@@ -742,6 +783,10 @@ namespace Test { namespace Int {
              (void) new RandomTupleSetTest("Rand(5,-10,10)", pos,
                                            IntSet(-10,10),
                                            randomTupleSet(5,-10,10,0.05));
+             (void) new RandomTupleSetTest("File::Rand(5,-10,10)", pos,
+                                           IntSet(-10,10),
+                                           persistent(randomTupleSet
+                                                      (5,-10,10,0.05)));
            }
            {
              TupleSet t(5);
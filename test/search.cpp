@@ -36,6 +36,10 @@
 
 #include "test/test.hh"
 
+#if defined(GECODE_SEARCH_HAS_DIST) && defined(GECODE_HAS_THREADS)
+#include <unistd.h>
+#endif
+
 namespace Test {
 
   /// Tests for search engines
@@ -297,6 +301,7 @@ namespace Test {
               b << expr(*this, x[i] == s->x[i]);
             rel(*this, BOT_AND, b, 0);
           }
+          mi.nogoods().post(*this);
           break;
         case MetaInfo::PORTFOLIO:
           // Do not kill the brancher!
@@ -333,6 +338,22 @@ namespace Test {
         GECODE_NEVER;
         return "";
       }
+      /// Map victim selection to string
+      static std::string str(Gecode::Search::StealMode sm) {
+        switch (sm) {
+        case Gecode::Search::STEAL_LINEAR:     return "Linear";
+        case Gecode::Search::STEAL_ROUNDROBIN: return "RoundRobin";
+        case Gecode::Search::STEAL_RANDOM:     return "Random";
+        case Gecode::Search::STEAL_RICHEST:    return "Richest";
+        default: GECODE_NEVER;
+        }
+        GECODE_NEVER;
+        return "";
+      }
+      /// Map number of subproblems to string (empty if none)
+      static std::string sub(unsigned int sp) {
+        return (sp > 0U) ? "::Sub"+str(sp) : std::string();
+      }
       /// Map constrain to string
       static std::string str(HowToConstrain htc) {
         switch (htc) {
@@ -364,14 +385,21 @@ namespace Test {
       unsigned int a_d;
       /// Number of threads
       unsigned int t;
+      /// Victim selection for stealing
+      Gecode::Search::StealMode sm;
+      /// Number of subproblems
+      unsigned int sp;
     public:
       /// Initialize test
       DFS(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
-          unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+          unsigned int c_d0, unsigned int a_d0, unsigned int t0,
+          Gecode::Search::StealMode sm0 = Gecode::Search::Config::steal,
+          unsigned int sp0 = 0U)
         : Test("DFS::"+Model::name()+"::"+
                str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
-               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
-               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), t(t0) {}
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0)+"::"+str(sm0)+sub(sp0),
+               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), t(t0), sm(sm0),
+          sp(sp0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3);
@@ -380,6 +408,8 @@ namespace Test {
         o.c_d = c_d;
         o.a_d = a_d;
         o.threads = t;
+        o.steal = sm;
+        o.subproblems = sp;
         o.stop = &f;
         Gecode::DFS<Model> dfs(m,o);
         int n = m->solutions();
@@ -444,15 +474,22 @@ namespace Test {
       unsigned int a_d;
       /// Number of threads
       unsigned int t;
+      /// Victim selection for stealing
+      Gecode::Search::StealMode sm;
+      /// Number of subproblems
+      unsigned int sp;
     public:
       /// Initialize test
       BAB(HowToConstrain htc,
           HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
-          unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+          unsigned int c_d0, unsigned int a_d0, unsigned int t0,
+          Gecode::Search::StealMode sm0 = Gecode::Search::Config::steal,
+          unsigned int sp0 = 0U)
         : Test("BAB::"+Model::name()+"::"+str(htc)+"::"+
                str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
-               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
-               htb1,htb2,htb3,htc), c_d(c_d0), a_d(a_d0), t(t0) {}
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0)+"::"+str(sm0)+sub(sp0),
+               htb1,htb2,htb3,htc), c_d(c_d0), a_d(a_d0), t(t0), sm(sm0),
+          sp(sp0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3,htc);
@@ -461,6 +498,8 @@ namespace Test {
         o.c_d = c_d;
         o.a_d = a_d;
         o.threads = t;
+        o.steal = sm;
+        o.subproblems = sp;
         o.stop = &f;
         Gecode::BAB<Model> bab(m,o);
         delete m;
@@ -484,23 +523,51 @@ namespace Test {
     template<class Model, template<class> class Engine>
     class RBS : public Test {
     private:
+      /// Whether only the best solution is checked
+      bool best;
       /// Number of threads
       unsigned int t;
+      /// Number of subproblems
+      unsigned int sp;
     public:
       /// Initialize test
-      RBS(const std::string& e, unsigned int t0)
-        : Test("RBS::"+e+"::"+Model::name()+"::"+str(t0),
-               HTB_BINARY,HTB_BINARY,HTB_BINARY), t(t0) {}
+      RBS(const std::string& e, bool b, unsigned int t0, unsigned int sp0 = 0U,
+          HowToConstrain htc0 = HTC_NONE)
+        : Test("RBS::"+e+"::"+Model::name()+
+               ((htc0 == HTC_NONE) ? std::string() : "::"+str(htc0))+
+               "::"+str(t0)+sub(sp0),
+               HTB_BINARY,HTB_BINARY,HTB_BINARY,htc0),
+          best(b), t(t0), sp(sp0) {}
       /// Run test
       virtual bool run(void) {
-        Model* m = new Model(htb1,htb2,htb3);
+        Model* m = new Model(htb1,htb2,htb3,htc);
         Gecode::Search::FailStop f(2);
         Gecode::Search::Options o;
         o.threads = t;
+        o.subproblems = sp;
         o.stop = &f;
         o.d_l = 100;
         o.cutoff = Gecode::Search::Cutoff::geometric(1,2);
+        if (best)
+          // Share no-goods between workers
+          o.nogoods_limit = 128;
         Gecode::RBS<Model,Engine> rbs(m,o);
+        if (best) {
+          // Workers restart independently and might report the same solution
+          Model* b = NULL;
+          while (true) {
+            Model* s = rbs.next();
+            if (s != NULL) {
+              delete b; b=s;
+            }
+            if ((s == NULL) && !rbs.stopped())
+              break;
+            f.limit(f.limit()+2);
+          }
+          bool ok = (b == NULL) || b->best();
+          delete b;
+          return ok;
+        }
         int n = m->solutions();
         delete m;
         while (true) {
@@ -647,6 +714,146 @@ namespace Test {
       }
     };
 
+#if defined(GECODE_SEARCH_HAS_DIST) && defined(GECODE_HAS_THREADS)
+    /// Results of a thread for distributed search
+    class DistTerminator : public Support::Terminator {
+    public:
+      /// Event to be signalled when the thread has terminated
+      Support::Event e;
+      /// Number of solutions found
+      int n;
+      /// Whether the thread has run successfully
+      bool ok;
+      /// Initialize
+      DistTerminator(void) : n(0), ok(true) {}
+      /// Signal event
+      virtual void terminated(void) {
+        e.signal();
+      }
+    };
+
+    /// Run coordinator for distributed search in a thread
+    class DistCoordinator : public Support::Runnable {
+    public:
+      /// The coordinator
+      Gecode::Search::Dist::Coordinator& c;
+      /// Terminator
+      DistTerminator& t;
+      /// Initialize
+      DistCoordinator(Gecode::Search::Dist::Coordinator& c0,
+                      DistTerminator& t0)
+        : c(c0), t(t0) {}
+      /// Return terminator
+      virtual Support::Terminator* terminator(void) const {
+        return &t;
+      }
+      /// Run coordinator
+      virtual void run(void) {
+        try {
+          c.run();
+        } catch (Gecode::Exception&) {
+          t.ok = false;
+        }
+      }
+    };
+
+    /// Run worker for distributed search in a thread
+    template<class Model>
+    class DistWorker : public Support::Runnable {
+    public:
+      /// Root space
+      Model* m;
+      /// Coordinator address
+      std::string a;
+      /// Terminator
+      DistTerminator& t;
+      /// Whether to perform best solution search
+      bool best;
+      /// Initialize
+      DistWorker(Model* m0, const std::string& a0, DistTerminator& t0,
+                 bool b)
+        : m(m0), a(a0), t(t0), best(b) {}
+      /// Return terminator
+      virtual Support::Terminator* terminator(void) const {
+        return &t;
+      }
+      /// Run worker
+      virtual void run(void) {
+        try {
+          if (best) {
+            Gecode::Search::Dist::BAB<Model> e(m,a);
+            Model* b = NULL;
+            while (Model* s = e.next()) {
+              delete b; b = s; t.n++;
+            }
+            t.ok = (b == NULL) || b->best();
+            delete b;
+          } else {
+            Gecode::Search::Dist::DFS<Model> e(m,a);
+            while (Model* s = e.next()) {
+              delete s; t.n++;
+            }
+          }
+        } catch (Gecode::Exception&) {
+          t.ok = false;
+        }
+        delete m;
+      }
+    };
+
+    /// %Test for distributed search
+    template<class Model>
+    class Dist : public Test {
+    private:
+      /// Number of workers
+      unsigned int w;
+    public:
+      /// Initialize test
+      Dist(HowToConstrain htc,
+           HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+           unsigned int w0)
+        : Test("Dist::"+Model::name()+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+str(w0),
+               htb1,htb2,htb3,htc), w(w0) {}
+      /// Run test
+      virtual bool run(void) {
+        static unsigned int k = 0;
+        std::stringstream p;
+        p << "/tmp/gecode-test-" << getpid() << "-" << k++;
+        std::string a = "unix:" + p.str();
+        bool best = (htc != HTC_NONE);
+        Gecode::Search::Dist::Coordinator c(a,w);
+        DistTerminator ct;
+        Support::Thread::run(new DistCoordinator(c,ct));
+        DistTerminator* wt = new DistTerminator[w];
+        for (unsigned int i=0; i<w; i++)
+          Support::Thread::run
+            (new DistWorker<Model>(new Model(htb1,htb2,htb3,htc),
+                                   a,wt[i],best));
+        int n = 0;
+        bool ok = true;
+        for (unsigned int i=0; i<w; i++) {
+          wt[i].e.wait();
+          n += wt[i].n;
+          ok = ok && wt[i].ok;
+        }
+        ct.e.wait();
+        ok = ok && ct.ok;
+        delete [] wt;
+        (void) unlink(p.str().c_str());
+        if (!ok || !c.complete())
+          return false;
+        if (!best) {
+          Model* m = new Model(htb1,htb2,htb3,htc);
+          int s = m->solutions();
+          delete m;
+          return (n == s) && (c.solutions() == static_cast<unsigned long int>(n));
+        }
+        return true;
+      }
+    };
+#endif
+
     /// Iterator for branching types
     class BranchTypes {
     private:
@@ -723,6 +930,30 @@ namespace Test {
                                     c_d, a_d, t);
             }
 
+        // Parallel depth-first search with different victim selection
+        for (unsigned int t = 2; t<=4; t++)
+          for (unsigned int c_d = 1; c_d<10; c_d += 4) {
+            (void) new DFS<HasSolutions>
+              (HTB_BINARY,HTB_NARY,HTB_UNARY,c_d,1,t,
+               Gecode::Search::STEAL_LINEAR);
+            (void) new DFS<HasSolutions>
+              (HTB_BINARY,HTB_NARY,HTB_UNARY,c_d,1,t,
+               Gecode::Search::STEAL_RANDOM);
+            (void) new DFS<HasSolutions>
+              (HTB_BINARY,HTB_NARY,HTB_UNARY,c_d,1,t,
+               Gecode::Search::STEAL_RICHEST);
+          }
+
+        // Parallel depth-first search with decomposition into subproblems
+        for (unsigned int t = 2; t<=4; t++)
+          for (unsigned int sp = 1; sp<=64; sp *= 4)
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2)
+                for (BranchTypes htb3; htb3(); ++htb3)
+                  (void) new DFS<HasSolutions>
+                    (htb1.htb(),htb2.htb(),htb3.htb(),1,1,t,
+                     Gecode::Search::Config::steal,sp);
+
         // Limited discrepancy search
         for (unsigned int t = 1; t<=4; t++) {
           for (BranchTypes htb1; htb1(); ++htb1)
@@ -753,18 +984,79 @@ namespace Test {
               (void) new BAB<HasSolutions>
                 (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
             }
+        // Parallel best solution search with different victim selection
+        for (unsigned int t = 2; t<=4; t++)
+          for (unsigned int c_d = 1; c_d<10; c_d += 4)
+            for (ConstrainTypes htc; htc(); ++htc) {
+              (void) new BAB<HasSolutions>
+                (htc.htc(),HTB_BINARY,HTB_NARY,HTB_UNARY,c_d,1,t,
+                 Gecode::Search::STEAL_LINEAR);
+              (void) new BAB<HasSolutions>
+                (htc.htc(),HTB_BINARY,HTB_NARY,HTB_UNARY,c_d,1,t,
+                 Gecode::Search::STEAL_RANDOM);
+              (void) new BAB<HasSolutions>
+                (htc.htc(),HTB_BINARY,HTB_NARY,HTB_UNARY,c_d,1,t,
+                 Gecode::Search::STEAL_RICHEST);
+            }
+        // Parallel best solution search with decomposition into subproblems
+        for (unsigned int t = 2; t<=4; t++)
+          for (unsigned int sp = 1; sp<=64; sp *= 4)
+            for (ConstrainTypes htc; htc(); ++htc) {
+              (void) new BAB<HasSolutions>
+                (htc.htc(),HTB_BINARY,HTB_NARY,HTB_UNARY,1,1,t,
+                 Gecode::Search::Config::steal,sp);
+              (void) new BAB<HasSolutions>
+                (htc.htc(),HTB_BINARY,HTB_NARY,HTB_UNARY,8,2,t,
+                 Gecode::Search::Config::steal,sp);
+            }
+        (void) new BAB<FailImmediate>
+          (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,1,1,2,
+           Gecode::Search::Config::steal,4);
+        (void) new BAB<SolveImmediate>
+          (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,1,1,2,
+           Gecode::Search::Config::steal,4);
+#if defined(GECODE_SEARCH_HAS_DIST) && defined(GECODE_HAS_THREADS)
+        // Distributed search
+        for (unsigned int w=1; w<=3; w++) {
+          for (BranchTypes htb1; htb1(); ++htb1)
+            for (BranchTypes htb2; htb2(); ++htb2)
+              for (BranchTypes htb3; htb3(); ++htb3)
+                (void) new Dist<HasSolutions>
+                  (HTC_NONE,htb1.htb(),htb2.htb(),htb3.htb(),w);
+          for (ConstrainTypes htc; htc(); ++htc)
+            (void) new Dist<HasSolutions>
+              (htc.htc(),HTB_BINARY,HTB_NARY,HTB_UNARY,w);
+          // Only the lexical orders have a unique best solution
+          (void) new Dist<HasSolutions>
+            (HTC_LEX_LE,HTB_BINARY,HTB_NARY,HTB_BINARY,w);
+          (void) new Dist<HasSolutions>
+            (HTC_LEX_GR,HTB_BINARY,HTB_NARY,HTB_BINARY,w);
+          (void) new Dist<FailImmediate>
+            (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,w);
+          (void) new Dist<SolveImmediate>
+            (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,w);
+        }
+#endif
         // Restart-based search
         for (unsigned int t=1; t<=4; t++) {
-          (void) new RBS<HasSolutions,Gecode::DFS>("DFS",t);
-          (void) new RBS<HasSolutions,Gecode::LDS>("LDS",t);
-          (void) new RBS<HasSolutions,Gecode::BAB>("BAB",t);
-          (void) new RBS<FailImmediate,Gecode::DFS>("DFS",t);
-          (void) new RBS<FailImmediate,Gecode::LDS>("LDS",t);
-          (void) new RBS<FailImmediate,Gecode::BAB>("BAB",t);
-          (void) new RBS<SolveImmediate,Gecode::DFS>("DFS",t);
-          (void) new RBS<SolveImmediate,Gecode::LDS>("LDS",t);
-          (void) new RBS<SolveImmediate,Gecode::BAB>("BAB",t);
+          (void) new RBS<HasSolutions,Gecode::DFS>("DFS",false,t);
+          (void) new RBS<HasSolutions,Gecode::LDS>("LDS",false,t);
+          (void) new RBS<HasSolutions,Gecode::BAB>("BAB",t > 1,t);
+          (void) new RBS<FailImmediate,Gecode::DFS>("DFS",false,t);
+          (void) new RBS<FailImmediate,Gecode::LDS>("LDS",false,t);
+          (void) new RBS<FailImmediate,Gecode::BAB>("BAB",t > 1,t);
+          (void) new RBS<SolveImmediate,Gecode::DFS>("DFS",false,t);
+          (void) new RBS<SolveImmediate,Gecode::LDS>("LDS",false,t);
+          (void) new RBS<SolveImmediate,Gecode::BAB>("BAB",t > 1,t);
+        }
+        for (unsigned int t=2; t<=4; t++) {
+          (void) new RBS<HasSolutions,Gecode::DFS>("DFS",false,t,8);
+          (void) new RBS<HasSolutions,Gecode::BAB>("BAB",true,t,8);
+          (void) new RBS<FailImmediate,Gecode::DFS>("DFS",false,t,8);
         }
+        for (unsigned int t=1; t<=4; t++)
+          for (ConstrainTypes htc; htc(); ++htc)
+            (void) new RBS<HasSolutions,Gecode::BAB>("BAB",true,t,0,htc.htc());
         // Portfolio-based search
         for (unsigned int a=1; a<=4; a++)
           for (unsigned int t=1; t<=2*a; t++) {
@@ -0,0 +1,71 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <iostream>
+#include <cstdlib>
+#include <gecode/search.hh>
+
+using namespace std;
+using namespace Gecode;
+
+int main(int argc, char** argv) {
+#ifdef GECODE_SEARCH_HAS_DIST
+  if (argc != 3) {
+    cerr << "Usage: " << argv[0] << " <address> <workers>" << endl
+         << "  <address> is unix:<path>, <host>:<port>, or <port>" << endl
+         << "  <workers> is the number of workers to wait for" << endl;
+    return EXIT_FAILURE;
+  }
+  try {
+    Search::Dist::Coordinator
+      c(argv[1],static_cast<unsigned int>(atoi(argv[2])));
+    c.run();
+    cout << "Distributed search" << endl
+         << "\tworkers:   " << c.workers() << endl
+         << "\tsubtrees:  " << c.subtrees() << endl
+         << "\tsteals:    " << c.steals() << endl
+         << "\tsolutions: " << c.solutions() << endl
+         << "\tcomplete:  " << (c.complete() ? "yes" : "no") << endl;
+  } catch (Exception& e) {
+    cerr << "Exception: " << e.what() << endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+#else
+  (void) argc;
+  cerr << argv[0] << ": distributed search is not supported" << endl;
+  return EXIT_FAILURE;
+#endif
+}
+
+// STATISTICS: search-other